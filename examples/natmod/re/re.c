@@ -3,6 +3,8 @@
 #define MICROPY_PY_RE_MATCH_GROUPS (1)
 #define MICROPY_PY_RE_MATCH_SPAN_START_END (1)
 #define MICROPY_PY_RE_SUB (0) // requires vstr interface
+#define MICROPY_PY_RE_PIKEVM (0) // keep the module small
+#define MICROPY_PY_RE_CACHE_SIZE (0) // requires a root pointer
 
 #include <alloca.h>
 #include "py/dynruntime.h"
@@ -46,10 +46,27 @@ static mp_obj_t bytes_fromhex_bytes(mp_obj_t data) {
 static MP_DEFINE_CONST_FUN_OBJ_1(bytes_fromhex_obj, bytes_fromhex_bytes);
 #endif
 
+#if MICROPY_OPT_BYTES_SCAN
+// The value of each ASCII character in the base64 alphabet, or -1.
+static const int8_t mod_binascii_sextets[128] = {
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 62, -1, -1, -1, 63,
+    52, 53, 54, 55, 56, 57, 58, 59, 60, 61, -1, -1, -1, -1, -1, -1,
+    -1, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, -1, -1, -1, -1, -1,
+    -1, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
+    41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, -1, -1, -1, -1, -1,
+};
+#endif
+
 // If ch is a character in the base64 alphabet, and is not a pad character, then
 // the corresponding integer between 0 and 63, inclusively, is returned.
 // Otherwise, -1 is returned.
 static int mod_binascii_sextet(byte ch) {
+    #if MICROPY_OPT_BYTES_SCAN
+    return ch < 128 ? mod_binascii_sextets[ch] : -1;
+    #else
     if (ch >= 'A' && ch <= 'Z') {
         return ch - 'A';
     } else if (ch >= 'a' && ch <= 'z') {
@@ -63,6 +80,7 @@ static int mod_binascii_sextet(byte ch) {
     } else {
         return -1;
     }
+    #endif
 }
 
 static mp_obj_t mod_binascii_a2b_base64(mp_obj_t data) {
@@ -78,6 +96,22 @@ static mp_obj_t mod_binascii_a2b_base64(mp_obj_t data) {
     int nbits = 0; // Number of meaningful bits in shift
     bool hadpad = false; // Had a pad character since last valid character
     for (size_t i = 0; i < bufinfo.len; i++) {
+        if (nbits == 0 && bufinfo.len - i >= 4) {
+            // Fast path for a whole group of 4 characters in the alphabet.
+            int a = mod_binascii_sextet(in[i]);
+            int b = mod_binascii_sextet(in[i + 1]);
+            int c = mod_binascii_sextet(in[i + 2]);
+            int d = mod_binascii_sextet(in[i + 3]);
+            if ((a | b | c | d) >= 0) {
+                uint group = a << 18 | b << 12 | c << 6 | d;
+                out[vstr.len++] = group >> 16;
+                out[vstr.len++] = group >> 8;
+                out[vstr.len++] = group;
+                hadpad = false;
+                i += 3;
+                continue;
+            }
+        }
         if (in[i] == '=') {
             if ((nbits == 2) || ((nbits == 4) && hadpad)) {
                 nbits = 0;
@@ -123,45 +157,28 @@ static mp_obj_t mod_binascii_b2a_base64(size_t n_args, const mp_obj_t *pos_args,
     vstr_t vstr;
     vstr_init_len(&vstr, ((bufinfo.len != 0) ? (((bufinfo.len - 1) / 3) + 1) * 4 : 0) + newline);
 
-    // First pass, we convert input buffer to numeric base 64 values
+    // Convert each group of 3 bytes to 4 characters, padding the last group
+    static const char alphabet[65] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/=";
     byte *in = bufinfo.buf, *out = (byte *)vstr.buf;
     mp_uint_t i;
     for (i = bufinfo.len; i >= 3; i -= 3) {
-        *out++ = (in[0] & 0xFC) >> 2;
-        *out++ = (in[0] & 0x03) << 4 | (in[1] & 0xF0) >> 4;
-        *out++ = (in[1] & 0x0F) << 2 | (in[2] & 0xC0) >> 6;
-        *out++ = in[2] & 0x3F;
+        uint group = in[0] << 16 | in[1] << 8 | in[2];
+        *out++ = alphabet[group >> 18];
+        *out++ = alphabet[(group >> 12) & 0x3F];
+        *out++ = alphabet[(group >> 6) & 0x3F];
+        *out++ = alphabet[group & 0x3F];
         in += 3;
     }
     if (i != 0) {
-        *out++ = (in[0] & 0xFC) >> 2;
+        *out++ = alphabet[(in[0] & 0xFC) >> 2];
         if (i == 2) {
-            *out++ = (in[0] & 0x03) << 4 | (in[1] & 0xF0) >> 4;
-            *out++ = (in[1] & 0x0F) << 2;
-        } else {
-            *out++ = (in[0] & 0x03) << 4;
-            *out++ = 64;
-        }
-        *out = 64;
-    }
-
-    // Second pass, we convert number base 64 values to actual base64 ascii encoding
-    out = (byte *)vstr.buf;
-    for (mp_uint_t j = vstr.len - newline; j--;) {
-        if (*out < 26) {
-            *out += 'A';
-        } else if (*out < 52) {
-            *out += 'a' - 26;
-        } else if (*out < 62) {
-            *out += '0' - 52;
-        } else if (*out == 62) {
-            *out = '+';
-        } else if (*out == 63) {
-            *out = '/';
+            *out++ = alphabet[(in[0] & 0x03) << 4 | (in[1] & 0xF0) >> 4];
+            *out++ = alphabet[(in[1] & 0x0F) << 2];
         } else {
-            *out = '=';
+            *out++ = alphabet[(in[0] & 0x03) << 4];
+            *out++ = '=';
         }
-        out++;
+        *out++ = '=';
     }
     if (newline) {
         *out = '\n';
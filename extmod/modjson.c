@@ -26,14 +26,240 @@
 
 #include <stdio.h>
 
+#include "py/cstack.h"
 #include "py/objlist.h"
-#include "py/objstringio.h"
+#include "py/objstr.h"
 #include "py/parsenum.h"
 #include "py/runtime.h"
 #include "py/stream.h"
 
 #if MICROPY_PY_JSON
 
+// The encoder below writes JSON into a vstr, which json.dump writes out to
+// the stream whenever it holds a block of MICROPY_PY_JSON_BUF_SIZE bytes.
+// Strings are escaped a run of bytes at a time and numbers are formatted
+// directly into the buffer.  Values of other types are printed with their
+// print method, as PRINT_JSON.
+
+typedef struct _json_encoder_t {
+    #if MICROPY_PY_JSON_SEPARATORS
+    mp_print_ext_t print; // for values that are printed by their type
+    #else
+    mp_print_t print;
+    #endif
+    vstr_t vstr;
+    mp_obj_t stream; // MP_OBJ_NULL for dumps
+    const char *item_separator;
+    const char *key_separator;
+    size_t item_separator_len;
+    size_t key_separator_len;
+    bool sort_keys;
+} json_encoder_t;
+
+static void json_encode(json_encoder_t *enc, mp_obj_t obj);
+
+static void json_encode_flush(json_encoder_t *enc) {
+    mp_stream_write(enc->stream, enc->vstr.buf, enc->vstr.len, MP_STREAM_RW_WRITE);
+    vstr_reset(&enc->vstr);
+}
+
+// Return the first byte in [p, end) that needs escaping, or end.
+static const byte *json_scan_safe(const byte *p, const byte *end) {
+    while ((size_t)(end - p) >= sizeof(mp_uint_t)) {
+        mp_uint_t v;
+        memcpy(&v, p, sizeof(v));
+        if (MP_WORD_HAS_LESS(v, 32) | MP_WORD_HAS_BYTE(v, '"') | MP_WORD_HAS_BYTE(v, '\\')) {
+            break;
+        }
+        p += sizeof(v);
+    }
+    while (p < end && *p >= 32 && *p != '"' && *p != '\\') {
+        ++p;
+    }
+    return p;
+}
+
+// Escape str_data as mp_str_print_json does.
+static void json_encode_str(json_encoder_t *enc, const byte *str_data, size_t str_len) {
+    vstr_t *vstr = &enc->vstr;
+    vstr_add_byte(vstr, '"');
+    for (const byte *s = str_data, *top = str_data + str_len; s < top;) {
+        const byte *run = s;
+        s = json_scan_safe(s, top);
+        vstr_add_strn(vstr, (const char *)run, s - run);
+        if (s == top) {
+            break;
+        }
+        byte c = *s++;
+        char *e = vstr_add_len(vstr, 2);
+        e[0] = '\\';
+        if (c == '"' || c == '\\') {
+            e[1] = c;
+        } else if (c == '\n') {
+            e[1] = 'n';
+        } else if (c == '\r') {
+            e[1] = 'r';
+        } else if (c == '\t') {
+            e[1] = 't';
+        } else {
+            // control chars
+            static const char hex[] = "0123456789abcdef";
+            e[1] = 'u';
+            e = vstr_add_len(vstr, 4);
+            e[0] = '0';
+            e[1] = '0';
+            e[2] = hex[c >> 4];
+            e[3] = hex[c & 0xf];
+        }
+    }
+    vstr_add_byte(vstr, '"');
+}
+
+static void json_encode_small_int(json_encoder_t *enc, mp_int_t val) {
+    char buf[sizeof(mp_int_t) * 3 + 2];
+    char *p = buf + sizeof(buf);
+    mp_uint_t u = val < 0 ? -(mp_uint_t)val : (mp_uint_t)val;
+    do {
+        *--p = '0' + u % 10;
+        u /= 10;
+    } while (u != 0);
+    if (val < 0) {
+        *--p = '-';
+    }
+    vstr_add_strn(&enc->vstr, p, buf + sizeof(buf) - p);
+}
+
+static void json_encode_dict_item(json_encoder_t *enc, mp_obj_t key, mp_obj_t value, bool first) {
+    if (!first) {
+        vstr_add_strn(&enc->vstr, enc->item_separator, enc->item_separator_len);
+    }
+    if (mp_obj_is_str_or_bytes(key)) {
+        json_encode(enc, key);
+    } else {
+        // keys must be strings, so quote anything else
+        vstr_add_byte(&enc->vstr, '"');
+        json_encode(enc, key);
+        vstr_add_byte(&enc->vstr, '"');
+    }
+    vstr_add_strn(&enc->vstr, enc->key_separator, enc->key_separator_len);
+    json_encode(enc, value);
+}
+
+static void json_encode_dict(json_encoder_t *enc, mp_obj_t obj) {
+    vstr_add_byte(&enc->vstr, '{');
+    if (enc->sort_keys) {
+        mp_obj_t keys = mp_obj_new_list(0, NULL);
+        size_t cur = 0;
+        mp_map_elem_t *elem;
+        while ((elem = mp_obj_dict_iter_next(obj, &cur)) != NULL) {
+            mp_obj_list_append(keys, elem->key);
+        }
+        mp_obj_list_sort(1, &keys, (mp_map_t *)&mp_const_empty_map);
+        size_t len;
+        mp_obj_t *items;
+        mp_obj_list_get(keys, &len, &items);
+        for (size_t i = 0; i < len; ++i) {
+            json_encode_dict_item(enc, items[i], mp_obj_dict_get(obj, items[i]), i == 0);
+        }
+    } else {
+        size_t cur = 0;
+        mp_map_elem_t *elem;
+        for (bool first = true; (elem = mp_obj_dict_iter_next(obj, &cur)) != NULL; first = false) {
+            json_encode_dict_item(enc, elem->key, elem->value, first);
+        }
+    }
+    vstr_add_byte(&enc->vstr, '}');
+}
+
+static void json_encode(json_encoder_t *enc, mp_obj_t obj) {
+    vstr_t *vstr = &enc->vstr;
+    if (vstr->len >= MICROPY_PY_JSON_BUF_SIZE) {
+        if (enc->stream != MP_OBJ_NULL) {
+            json_encode_flush(enc);
+        } else if (vstr->alloc - vstr->len < MICROPY_PY_JSON_BUF_SIZE) {
+            // a vstr grows by what is added to it, so grow it geometrically
+            // here to keep building a large str linear
+            vstr_hint_size(vstr, vstr->len);
+        }
+    }
+    if (obj == mp_const_none) {
+        vstr_add_strn(vstr, "null", 4);
+    } else if (obj == mp_const_true) {
+        vstr_add_strn(vstr, "true", 4);
+    } else if (obj == mp_const_false) {
+        vstr_add_strn(vstr, "false", 5);
+    } else if (mp_obj_is_small_int(obj)) {
+        json_encode_small_int(enc, MP_OBJ_SMALL_INT_VALUE(obj));
+    } else if (mp_obj_is_str_or_bytes(obj)
+               #if MICROPY_PY_BUILTINS_BYTEARRAY
+               || mp_obj_is_type(obj, &mp_type_bytearray)
+               #endif
+               #if MICROPY_PY_BUILTINS_MEMORYVIEW
+               || mp_obj_is_type(obj, &mp_type_memoryview)
+               #endif
+               ) {
+        // str and all the bytes-like types are written as strings
+        mp_buffer_info_t bufinfo;
+        mp_get_buffer_raise(obj, &bufinfo, MP_BUFFER_READ);
+        json_encode_str(enc, bufinfo.buf, bufinfo.len);
+    #if MICROPY_PY_BUILTINS_FLOAT
+    } else if (mp_obj_is_float(obj)) {
+        char *buf = vstr_add_len(vstr, MP_FLOAT_REPR_BUF_SIZE);
+        vstr->len -= MP_FLOAT_REPR_BUF_SIZE - mp_float_repr(mp_obj_float_get(obj), buf);
+    #endif
+    } else if (mp_obj_is_exact_type(obj, &mp_type_list) || mp_obj_is_exact_type(obj, &mp_type_tuple)) {
+        mp_cstack_check();
+        size_t len;
+        mp_obj_t *items;
+        mp_obj_get_array(obj, &len, &items);
+        vstr_add_byte(vstr, '[');
+        for (size_t i = 0; i < len; ++i) {
+            if (i > 0) {
+                vstr_add_strn(vstr, enc->item_separator, enc->item_separator_len);
+            }
+            json_encode(enc, items[i]);
+        }
+        vstr_add_byte(vstr, ']');
+    } else if (mp_obj_is_dict_or_ordereddict(obj)) {
+        mp_cstack_check();
+        json_encode_dict(enc, obj);
+    } else {
+        #if MICROPY_PY_JSON_SEPARATORS
+        mp_obj_print_helper(&enc->print.base, obj, PRINT_JSON);
+        #else
+        mp_obj_print_helper(&enc->print, obj, PRINT_JSON);
+        #endif
+    }
+}
+
+// Encode obj to the stream, or to a new str if stream is MP_OBJ_NULL.
+static mp_obj_t json_encode_obj(mp_obj_t obj, mp_obj_t stream, const char *item_separator, const char *key_separator, bool sort_keys) {
+    json_encoder_t enc;
+    if (stream != MP_OBJ_NULL) {
+        mp_get_stream_raise(stream, MP_STREAM_OP_WRITE);
+    }
+    #if MICROPY_PY_JSON_SEPARATORS
+    vstr_init_print(&enc.vstr, stream == MP_OBJ_NULL ? 16 : MICROPY_PY_JSON_BUF_SIZE, &enc.print.base);
+    enc.print.item_separator = item_separator;
+    enc.print.key_separator = key_separator;
+    #else
+    vstr_init_print(&enc.vstr, stream == MP_OBJ_NULL ? 16 : MICROPY_PY_JSON_BUF_SIZE, &enc.print);
+    #endif
+    enc.stream = stream;
+    enc.item_separator = item_separator;
+    enc.key_separator = key_separator;
+    enc.item_separator_len = strlen(item_separator);
+    enc.key_separator_len = strlen(key_separator);
+    enc.sort_keys = sort_keys;
+    json_encode(&enc, obj);
+    if (stream == MP_OBJ_NULL) {
+        return mp_obj_new_str_from_utf8_vstr(&enc.vstr);
+    }
+    json_encode_flush(&enc);
+    vstr_clear(&enc.vstr);
+    return mp_const_none;
+}
+
 #if MICROPY_PY_JSON_SEPARATORS
 
 enum {
@@ -42,39 +268,30 @@ enum {
 };
 
 static mp_obj_t mod_json_dump_helper(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args, unsigned int mode) {
-    enum { ARG_separators };
+    enum { ARG_separators, ARG_sort_keys };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_separators, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
+        { MP_QSTR_sort_keys, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
     };
 
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all(n_args - mode, pos_args + mode, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
 
-    mp_print_ext_t print_ext;
-
-    if (args[ARG_separators].u_obj == mp_const_none) {
-        print_ext.item_separator = ", ";
-        print_ext.key_separator = ": ";
-    } else {
+    const char *item_separator = ", ";
+    const char *key_separator = ": ";
+    if (args[ARG_separators].u_obj != mp_const_none) {
         mp_obj_t *items;
         mp_obj_get_array_fixed_n(args[ARG_separators].u_obj, 2, &items);
-        print_ext.item_separator = mp_obj_str_get_str(items[0]);
-        print_ext.key_separator = mp_obj_str_get_str(items[1]);
+        item_separator = mp_obj_str_get_str(items[0]);
+        key_separator = mp_obj_str_get_str(items[1]);
     }
 
     if (mode == DUMP_MODE_TO_STRING) {
         // dumps(obj)
-        vstr_t vstr;
-        vstr_init_print(&vstr, 8, &print_ext.base);
-        mp_obj_print_helper(&print_ext.base, pos_args[0], PRINT_JSON);
-        return mp_obj_new_str_from_utf8_vstr(&vstr);
+        return json_encode_obj(pos_args[0], MP_OBJ_NULL, item_separator, key_separator, args[ARG_sort_keys].u_bool);
     } else {
         // dump(obj, stream)
-        print_ext.base.data = MP_OBJ_TO_PTR(pos_args[1]);
-        print_ext.base.print_strn = mp_stream_write_adaptor;
-        mp_get_stream_raise(pos_args[1], MP_STREAM_OP_WRITE);
-        mp_obj_print_helper(&print_ext.base, pos_args[0], PRINT_JSON);
-        return mp_const_none;
+        return json_encode_obj(pos_args[0], pos_args[1], item_separator, key_separator, args[ARG_sort_keys].u_bool);
     }
 }
 
@@ -91,19 +308,12 @@ static MP_DEFINE_CONST_FUN_OBJ_KW(mod_json_dumps_obj, 1, mod_json_dumps);
 #else
 
 static mp_obj_t mod_json_dump(mp_obj_t obj, mp_obj_t stream) {
-    mp_get_stream_raise(stream, MP_STREAM_OP_WRITE);
-    mp_print_t print = {MP_OBJ_TO_PTR(stream), mp_stream_write_adaptor};
-    mp_obj_print_helper(&print, obj, PRINT_JSON);
-    return mp_const_none;
+    return json_encode_obj(obj, stream, ", ", ": ", false);
 }
 static MP_DEFINE_CONST_FUN_OBJ_2(mod_json_dump_obj, mod_json_dump);
 
 static mp_obj_t mod_json_dumps(mp_obj_t obj) {
-    vstr_t vstr;
-    mp_print_t print;
-    vstr_init_print(&vstr, 8, &print);
-    mp_obj_print_helper(&print, obj, PRINT_JSON);
-    return mp_obj_new_str_from_utf8_vstr(&vstr);
+    return json_encode_obj(obj, MP_OBJ_NULL, ", ", ": ", false);
 }
 static MP_DEFINE_CONST_FUN_OBJ_1(mod_json_dumps_obj, mod_json_dumps);
 
@@ -119,44 +329,230 @@ static MP_DEFINE_CONST_FUN_OBJ_1(mod_json_dumps_obj, mod_json_dumps);
 // input is outside it's specs.
 //
 // Most of the work is parsing the primitives (null, false, true, numbers,
-// strings).  It does 1 pass over the input stream.  It tries to be fast and
-// small in code size, while not using more RAM than necessary.
+// strings).  It does 1 pass over the input, which is either a str/bytes
+// object parsed in place or a stream read in chunks.  Strings and whitespace
+// are scanned a machine word at a time, and strings and numbers that lie
+// entirely within the buffer are converted straight from it.
 
 typedef struct _json_stream_t {
-    mp_obj_t stream_obj;
+    mp_obj_t stream_obj; // MP_OBJ_NULL when parsing a buffer in place
     mp_uint_t (*read)(mp_obj_t obj, void *buf, mp_uint_t size, int *errcode);
-    int errcode;
-    byte cur;
+    const byte *start; // start of the current chunk
+    const byte *cur;
+    const byte *end;
+    byte *buf;
 } json_stream_t;
 
 #define S_EOF (0) // null is not allowed in json stream so is ok as EOF marker
-#define S_END(s) ((s).cur == S_EOF)
-#define S_CUR(s) ((s).cur)
-#define S_NEXT(s) (json_stream_next(&(s)))
+#define S_END(s) (S_CUR(s) == S_EOF)
+#define S_CUR(s) ((s).cur < (s).end ? *(s).cur : json_stream_fill(&(s)))
+#define S_NEXT(s) (++(s).cur, S_CUR(s))
 
-static byte json_stream_next(json_stream_t *s) {
-    mp_uint_t ret = s->read(s->stream_obj, &s->cur, 1, &s->errcode);
-    if (s->errcode != 0) {
-        mp_raise_OSError(s->errcode);
+// Read the next chunk of the stream, returning its first byte or S_EOF.
+static byte json_stream_fill(json_stream_t *s) {
+    if (s->stream_obj == MP_OBJ_NULL) {
+        return S_EOF;
+    }
+    int errcode;
+    mp_uint_t ret = s->read(s->stream_obj, s->buf, MICROPY_PY_JSON_BUF_SIZE, &errcode);
+    if (ret == MP_STREAM_ERROR) {
+        mp_raise_OSError(errcode);
     }
+    s->start = s->buf;
+    s->cur = s->buf;
+    s->end = s->buf + ret;
     if (ret == 0) {
-        s->cur = S_EOF;
+        s->stream_obj = MP_OBJ_NULL;
+        return S_EOF;
     }
-    return s->cur;
+    return *s->cur;
 }
 
-static mp_obj_t mod_json_load(mp_obj_t stream_obj) {
-    const mp_stream_p_t *stream_p = mp_get_stream_raise(stream_obj, MP_STREAM_OP_READ);
-    json_stream_t s = {stream_obj, stream_p->read, 0, 0};
+// Return the first quote, backslash or null in [p, end), or end.
+static const byte *json_scan_str(const byte *p, const byte *end) {
+    while ((size_t)(end - p) >= sizeof(mp_uint_t)) {
+        mp_uint_t v;
+        memcpy(&v, p, sizeof(v));
+        if (MP_WORD_HAS_ZERO(v) | MP_WORD_HAS_BYTE(v, '"') | MP_WORD_HAS_BYTE(v, '\\')) {
+            break;
+        }
+        p += sizeof(v);
+    }
+    while (p < end && *p != '"' && *p != '\\' && *p != 0) {
+        ++p;
+    }
+    return p;
+}
+
+// Skip whitespace, including the separators that the parser ignores.
+static void json_skip_space(json_stream_t *s) {
+    for (;;) {
+        const byte *p = s->cur;
+        while ((size_t)(s->end - p) >= sizeof(mp_uint_t)) {
+            // runs of spaces are common in indented documents
+            mp_uint_t v;
+            memcpy(&v, p, sizeof(v));
+            if (v != MP_WORD_ONES * ' ') {
+                break;
+            }
+            p += sizeof(v);
+        }
+        while (p < s->end && (*p == ' ' || *p == '\n' || *p == '\r' || *p == '\t' || *p == ',' || *p == ':')) {
+            ++p;
+        }
+        s->cur = p;
+        if (p < s->end || json_stream_fill(s) == S_EOF) {
+            return;
+        }
+    }
+}
+
+// Object keys are often repeated, so reuse the str made for an earlier key
+// with the same text.  This saves allocating a new str for each occurrence.
+#define JSON_KEY_CACHE_SIZE (32)
+
+static mp_obj_t json_new_key(mp_obj_t *key_cache, const byte *data, size_t len) {
+    size_t hash = qstr_compute_hash(data, len);
+    mp_obj_t *slot = &key_cache[hash & (JSON_KEY_CACHE_SIZE - 1)];
+    if (*slot != MP_OBJ_NULL) {
+        GET_STR_DATA_LEN(*slot, key_data, key_len);
+        if (key_len == len && memcmp(key_data, data, len) == 0) {
+            return *slot;
+        }
+    }
+    *slot = mp_obj_new_str((const char *)data, len);
+    return *slot;
+}
+
+// Parse the rest of a string after its opening quote.
+static mp_obj_t json_parse_str(json_stream_t *s, vstr_t *vstr, mp_obj_t *key_cache) {
+    const byte *start = s->cur;
+    const byte *p = json_scan_str(start, s->end);
+    if (p < s->end && *p == '"') {
+        // the whole string is in the buffer and has no escapes
+        s->cur = p + 1;
+        if (key_cache != NULL) {
+            return json_new_key(key_cache, start, p - start);
+        }
+        return mp_obj_new_str((const char *)start, p - start);
+    }
+
+    vstr_reset(vstr);
+    for (;;) {
+        vstr_add_strn(vstr, (const char *)start, p - start);
+        s->cur = p;
+        byte c = S_CUR(*s);
+        if (c == '"') {
+            break;
+        }
+        if (c == S_EOF) {
+            return MP_OBJ_NULL;
+        }
+        if (c == '\\') {
+            c = S_NEXT(*s);
+            switch (c) {
+                case 'b':
+                    c = 0x08;
+                    break;
+                case 'f':
+                    c = 0x0c;
+                    break;
+                case 'n':
+                    c = 0x0a;
+                    break;
+                case 'r':
+                    c = 0x0d;
+                    break;
+                case 't':
+                    c = 0x09;
+                    break;
+                case 'u': {
+                    mp_uint_t num = 0;
+                    for (int i = 0; i < 4; i++) {
+                        c = (S_NEXT(*s) | 0x20) - '0';
+                        if (c > 9) {
+                            c -= ('a' - ('9' + 1));
+                        }
+                        num = (num << 4) | c;
+                    }
+                    vstr_add_char(vstr, num);
+                    goto str_cont;
+                }
+            }
+            if (c == S_EOF) {
+                return MP_OBJ_NULL;
+            }
+            vstr_add_byte(vstr, c);
+        str_cont:
+            S_NEXT(*s);
+        }
+        start = s->cur;
+        p = json_scan_str(start, s->end);
+    }
+    S_NEXT(*s);
+    return mp_obj_new_str(vstr->buf, vstr->len);
+}
+
+static bool json_is_num_char(byte c) {
+    return unichar_isdigit(c) || c == '+' || c == '-' || c == '.' || c == 'E' || c == 'e';
+}
+
+// Parse a number whose first character, already consumed, is c.
+static mp_obj_t json_parse_num(json_stream_t *s, vstr_t *vstr, byte c) {
+    const byte *start;
+    const byte *p = s->cur;
+    while (p < s->end && json_is_num_char(*p)) {
+        ++p;
+    }
+    size_t len;
+    if (s->cur > s->start && (p < s->end || s->stream_obj == MP_OBJ_NULL)) {
+        // the whole number is in the buffer, including its first character
+        start = s->cur - 1;
+        len = p - start;
+        s->cur = p;
+    } else {
+        // the number crosses the end of the chunk
+        vstr_reset(vstr);
+        vstr_add_byte(vstr, c);
+        vstr_add_strn(vstr, (const char *)s->cur, p - s->cur);
+        s->cur = p;
+        for (c = S_CUR(*s); json_is_num_char(c); c = S_NEXT(*s)) {
+            vstr_add_byte(vstr, c);
+        }
+        start = (const byte *)vstr->buf;
+        len = vstr->len;
+    }
+
+    // Parse small integers directly, and anything else with the full parsers.
+    size_t i = start[0] == '-';
+    if (len > i && len - i < sizeof(mp_int_t) * 2) {
+        mp_int_t val = 0;
+        for (; i < len && unichar_isdigit(start[i]); ++i) {
+            val = val * 10 + (start[i] - '0');
+        }
+        if (i == len) {
+            return mp_obj_new_int(start[0] == '-' ? -val : val);
+        }
+    }
+    for (i = 0; i < len; ++i) {
+        if (start[i] == '.' || start[i] == 'E' || start[i] == 'e') {
+            return mp_parse_num_float((const char *)start, len, false, NULL);
+        }
+    }
+    return mp_parse_num_integer((const char *)start, len, 10, NULL);
+}
+
+static mp_obj_t json_load(json_stream_t *s_in) {
+    json_stream_t s = *s_in;
     vstr_t vstr;
     vstr_init(&vstr, 8);
+    mp_obj_t key_cache[JSON_KEY_CACHE_SIZE] = { MP_OBJ_NULL };
     mp_obj_list_t stack; // we use a list as a simple stack for nested JSON
     stack.len = 0;
     stack.items = NULL;
     mp_obj_t stack_top = MP_OBJ_NULL;
     const mp_obj_type_t *stack_top_type = NULL;
     mp_obj_t stack_key = MP_OBJ_NULL;
-    S_NEXT(s);
     for (;;) {
     cont:
         if (S_END(s)) {
@@ -173,6 +569,7 @@ static mp_obj_t mod_json_load(mp_obj_t stream_obj) {
             case '\t':
             case '\n':
             case '\r':
+                json_skip_space(&s);
                 goto cont;
             case 'n':
                 if (S_CUR(s) == 'u' && S_NEXT(s) == 'l' && S_NEXT(s) == 'l') {
@@ -198,52 +595,14 @@ static mp_obj_t mod_json_load(mp_obj_t stream_obj) {
                     goto fail;
                 }
                 break;
-            case '"':
-                vstr_reset(&vstr);
-                for (; !S_END(s) && S_CUR(s) != '"';) {
-                    byte c = S_CUR(s);
-                    if (c == '\\') {
-                        c = S_NEXT(s);
-                        switch (c) {
-                            case 'b':
-                                c = 0x08;
-                                break;
-                            case 'f':
-                                c = 0x0c;
-                                break;
-                            case 'n':
-                                c = 0x0a;
-                                break;
-                            case 'r':
-                                c = 0x0d;
-                                break;
-                            case 't':
-                                c = 0x09;
-                                break;
-                            case 'u': {
-                                mp_uint_t num = 0;
-                                for (int i = 0; i < 4; i++) {
-                                    c = (S_NEXT(s) | 0x20) - '0';
-                                    if (c > 9) {
-                                        c -= ('a' - ('9' + 1));
-                                    }
-                                    num = (num << 4) | c;
-                                }
-                                vstr_add_char(&vstr, num);
-                                goto str_cont;
-                            }
-                        }
-                    }
-                    vstr_add_byte(&vstr, c);
-                str_cont:
-                    S_NEXT(s);
-                }
-                if (S_END(s)) {
+            case '"': {
+                bool is_key = stack_top_type == &mp_type_dict && stack_key == MP_OBJ_NULL;
+                next = json_parse_str(&s, &vstr, is_key ? key_cache : NULL);
+                if (next == MP_OBJ_NULL) {
                     goto fail;
                 }
-                S_NEXT(s);
-                next = mp_obj_new_str(vstr.buf, vstr.len);
                 break;
+            }
             case '-':
             case '0':
             case '1':
@@ -254,28 +613,9 @@ static mp_obj_t mod_json_load(mp_obj_t stream_obj) {
             case '6':
             case '7':
             case '8':
-            case '9': {
-                bool flt = false;
-                vstr_reset(&vstr);
-                for (;;) {
-                    vstr_add_byte(&vstr, cur);
-                    cur = S_CUR(s);
-                    if (cur == '.' || cur == 'E' || cur == 'e') {
-                        flt = true;
-                    } else if (cur == '+' || cur == '-' || unichar_isdigit(cur)) {
-                        // pass
-                    } else {
-                        break;
-                    }
-                    S_NEXT(s);
-                }
-                if (flt) {
-                    next = mp_parse_num_float(vstr.buf, vstr.len, false, NULL);
-                } else {
-                    next = mp_parse_num_integer(vstr.buf, vstr.len, 10, NULL);
-                }
+            case '9':
+                next = json_parse_num(&s, &vstr, cur);
                 break;
-            }
             case '[':
                 next = mp_obj_new_list(0, NULL);
                 enter = true;
@@ -355,23 +695,232 @@ success:
 fail:
     mp_raise_ValueError(MP_ERROR_TEXT("syntax error in JSON"));
 }
+
+static mp_obj_t mod_json_load(mp_obj_t stream_obj) {
+    const mp_stream_p_t *stream_p = mp_get_stream_raise(stream_obj, MP_STREAM_OP_READ);
+    byte buf[MICROPY_PY_JSON_BUF_SIZE];
+    json_stream_t s = {stream_obj, stream_p->read, buf, buf, buf, buf};
+    return json_load(&s);
+}
 static MP_DEFINE_CONST_FUN_OBJ_1(mod_json_load_obj, mod_json_load);
 
 static mp_obj_t mod_json_loads(mp_obj_t obj) {
     mp_buffer_info_t bufinfo;
     mp_get_buffer_raise(obj, &bufinfo, MP_BUFFER_READ);
-    vstr_t vstr = {bufinfo.len, bufinfo.len, (char *)bufinfo.buf, true};
-    mp_obj_stringio_t sio = {{&mp_type_stringio}, &vstr, 0, MP_OBJ_NULL};
-    return mod_json_load(MP_OBJ_FROM_PTR(&sio));
+    const byte *data = bufinfo.buf;
+    json_stream_t s = {MP_OBJ_NULL, NULL, data, data, data + bufinfo.len, NULL};
+    return json_load(&s);
 }
 static MP_DEFINE_CONST_FUN_OBJ_1(mod_json_loads_obj, mod_json_loads);
 
+#if MICROPY_PY_JSON_INCREMENTAL
+
+// An incremental decoder is fed the input in chunks and iterating it gives
+// (event, value) tuples for the parts of the document seen so far, in the
+// style of ijson.  The events are "start_map", "map_key", "end_map",
+// "start_array", "end_array", "null", "boolean", "number" and "string".
+// Iteration stops when more input is needed.  Only the unparsed input and the
+// nesting of containers are kept, so memory use does not grow with the size
+// of the document.  A sequence of top-level values is allowed.
+
+// What each open container is expecting next.
+enum {
+    JSON_IN_ARRAY,
+    JSON_IN_MAP_KEY,
+    JSON_IN_MAP_VALUE,
+};
+
+typedef struct _mp_obj_json_decoder_t {
+    mp_obj_base_t base;
+    bool closed;
+    size_t pos; // start of the unparsed input in buf
+    vstr_t buf;
+    vstr_t vstr;
+    vstr_t stack; // one JSON_IN_xxx byte per open container
+    mp_obj_t key_cache[JSON_KEY_CACHE_SIZE];
+} mp_obj_json_decoder_t;
+
+static mp_obj_t json_decoder_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
+    mp_arg_check_num(n_args, n_kw, 0, 0, false);
+    mp_obj_json_decoder_t *self = mp_obj_malloc(mp_obj_json_decoder_t, type);
+    self->closed = false;
+    self->pos = 0;
+    vstr_init(&self->buf, 16);
+    vstr_init(&self->vstr, 8);
+    vstr_init(&self->stack, 8);
+    for (size_t i = 0; i < JSON_KEY_CACHE_SIZE; ++i) {
+        self->key_cache[i] = MP_OBJ_NULL;
+    }
+    return MP_OBJ_FROM_PTR(self);
+}
+
+static mp_obj_t json_decoder_feed(mp_obj_t self_in, mp_obj_t data_in) {
+    mp_obj_json_decoder_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(data_in, &bufinfo, MP_BUFFER_READ);
+    // drop the input that has been parsed
+    if (self->pos > 0) {
+        memmove(self->buf.buf, self->buf.buf + self->pos, self->buf.len - self->pos);
+        self->buf.len -= self->pos;
+        self->pos = 0;
+    }
+    vstr_add_strn(&self->buf, bufinfo.buf, bufinfo.len);
+    return self_in;
+}
+static MP_DEFINE_CONST_FUN_OBJ_2(json_decoder_feed_obj, json_decoder_feed);
+
+static mp_obj_t json_decoder_close(mp_obj_t self_in) {
+    mp_obj_json_decoder_t *self = MP_OBJ_TO_PTR(self_in);
+    self->closed = true;
+    return self_in;
+}
+static MP_DEFINE_CONST_FUN_OBJ_1(json_decoder_close_obj, json_decoder_close);
+
+static mp_obj_t json_decoder_iternext(mp_obj_t self_in) {
+    mp_obj_json_decoder_t *self = MP_OBJ_TO_PTR(self_in);
+    const byte *buf = (const byte *)self->buf.buf;
+    json_stream_t s = {MP_OBJ_NULL, NULL, buf + self->pos, buf + self->pos, buf + self->buf.len, NULL};
+    json_skip_space(&s);
+    self->pos = s.cur - buf;
+    if (s.cur == s.end) {
+        goto need_more;
+    }
+
+    byte *top = self->stack.len == 0 ? NULL : (byte *)&self->stack.buf[self->stack.len - 1];
+    byte cur = *s.cur++;
+    if (top != NULL && *top == JSON_IN_MAP_KEY && cur != '"' && cur != '}') {
+        goto fail;
+    }
+
+    qstr event;
+    mp_obj_t value = mp_const_none;
+    switch (cur) {
+        case '{':
+        case '[':
+            if (top != NULL && *top == JSON_IN_MAP_VALUE) {
+                *top = JSON_IN_MAP_KEY;
+            }
+            vstr_add_byte(&self->stack, cur == '{' ? JSON_IN_MAP_KEY : JSON_IN_ARRAY);
+            top = NULL;
+            event = cur == '{' ? MP_QSTR_start_map : MP_QSTR_start_array;
+            break;
+        case '}':
+        case ']':
+            if (top == NULL || *top != (cur == '}' ? JSON_IN_MAP_KEY : JSON_IN_ARRAY)) {
+                goto fail;
+            }
+            self->stack.len -= 1;
+            top = NULL;
+            event = cur == '}' ? MP_QSTR_end_map : MP_QSTR_end_array;
+            break;
+        case '"': {
+            bool is_key = top != NULL && *top == JSON_IN_MAP_KEY;
+            value = json_parse_str(&s, &self->vstr, is_key ? self->key_cache : NULL);
+            if (value == MP_OBJ_NULL) {
+                if (s.cur >= s.end) {
+                    goto need_more;
+                }
+                goto fail;
+            }
+            event = is_key ? MP_QSTR_map_key : MP_QSTR_string;
+            break;
+        }
+        case 'n':
+        case 't':
+        case 'f': {
+            static const char *const literals[] = {"null", "true", "false"};
+            const char *lit = literals[(cur == 't') + 2 * (cur == 'f')];
+            size_t len = strlen(lit);
+            if ((size_t)(s.end - (s.cur - 1)) < len) {
+                goto need_more;
+            }
+            if (memcmp(s.cur - 1, lit, len) != 0) {
+                goto fail;
+            }
+            s.cur += len - 1;
+            if (cur == 'n') {
+                event = MP_QSTR_null;
+            } else {
+                event = MP_QSTR_boolean;
+                value = mp_obj_new_bool(cur == 't');
+            }
+            break;
+        }
+        case '-':
+        case '0':
+        case '1':
+        case '2':
+        case '3':
+        case '4':
+        case '5':
+        case '6':
+        case '7':
+        case '8':
+        case '9': {
+            // a number is only complete once something follows it
+            const byte *p = s.cur;
+            while (p < s.end && json_is_num_char(*p)) {
+                ++p;
+            }
+            if (p == s.end && !self->closed) {
+                goto need_more;
+            }
+            value = json_parse_num(&s, &self->vstr, cur);
+            event = MP_QSTR_number;
+            break;
+        }
+        default:
+            goto fail;
+    }
+
+    // In a map a key is followed by its value, and a value by the next key.
+    // The parent of a container was updated when the container started.
+    if (top != NULL && *top == JSON_IN_MAP_KEY) {
+        *top = JSON_IN_MAP_VALUE;
+    } else if (top != NULL && *top == JSON_IN_MAP_VALUE) {
+        *top = JSON_IN_MAP_KEY;
+    }
+    self->pos = s.cur - buf;
+    mp_obj_t items[2] = {MP_OBJ_NEW_QSTR(event), value};
+    return mp_obj_new_tuple(2, items);
+
+need_more:
+    if (self->closed && (self->pos < self->buf.len || self->stack.len != 0)) {
+        // the input ended part way through a value
+        goto fail;
+    }
+    return MP_OBJ_STOP_ITERATION;
+
+fail:
+    mp_raise_ValueError(MP_ERROR_TEXT("syntax error in JSON"));
+}
+
+static const mp_rom_map_elem_t json_decoder_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_feed), MP_ROM_PTR(&json_decoder_feed_obj) },
+    { MP_ROM_QSTR(MP_QSTR_close), MP_ROM_PTR(&json_decoder_close_obj) },
+};
+static MP_DEFINE_CONST_DICT(json_decoder_locals_dict, json_decoder_locals_dict_table);
+
+static MP_DEFINE_CONST_OBJ_TYPE(
+    mp_type_json_incremental_decoder,
+    MP_QSTR_IncrementalDecoder,
+    MP_TYPE_FLAG_ITER_IS_ITERNEXT,
+    make_new, json_decoder_make_new,
+    iter, json_decoder_iternext,
+    locals_dict, &json_decoder_locals_dict
+    );
+
+#endif // MICROPY_PY_JSON_INCREMENTAL
+
 static const mp_rom_map_elem_t mp_module_json_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_json) },
     { MP_ROM_QSTR(MP_QSTR_dump), MP_ROM_PTR(&mod_json_dump_obj) },
     { MP_ROM_QSTR(MP_QSTR_dumps), MP_ROM_PTR(&mod_json_dumps_obj) },
     { MP_ROM_QSTR(MP_QSTR_load), MP_ROM_PTR(&mod_json_load_obj) },
     { MP_ROM_QSTR(MP_QSTR_loads), MP_ROM_PTR(&mod_json_loads_obj) },
+    #if MICROPY_PY_JSON_INCREMENTAL
+    { MP_ROM_QSTR(MP_QSTR_IncrementalDecoder), MP_ROM_PTR(&mp_type_json_incremental_decoder) },
+    #endif
 };
 
 static MP_DEFINE_CONST_DICT(mp_module_json_globals, mp_module_json_globals_table);
@@ -47,6 +47,11 @@
 
 typedef struct _mp_obj_re_t {
     mp_obj_base_t base;
+    #if MICROPY_PY_RE_CACHE_SIZE
+    mp_obj_t pattern;
+    mp_int_t flags;
+    #endif
+    int literal_len; // length of the plain string the pattern matches, or -1
     ByteProg re;
 } mp_obj_re_t;
 
@@ -194,6 +199,76 @@ static void re_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t
     mp_printf(print, "<re %p>", self);
 }
 
+#if MICROPY_PY_RE_PIKEVM
+
+// Patterns are executed by a Pike VM, which takes time linear in the length
+// of the subject and does not recurse.  Its workspace is sized by the pattern
+// and is kept on the C stack when it is small enough.
+
+#define RE_WORK_STACK_WORDS (256)
+
+typedef struct _re_work_t {
+    void *buf;
+    size_t size;
+    mp_uint_t stack_buf[RE_WORK_STACK_WORDS];
+} re_work_t;
+
+static void re_work_init(re_work_t *work, mp_obj_re_t *self, int caps_num) {
+    work->size = re1_5_pikevm_worksize(&self->re, caps_num);
+    if (work->size <= sizeof(work->stack_buf)) {
+        work->buf = work->stack_buf;
+    } else {
+        work->buf = m_new(char, work->size);
+    }
+}
+
+static void re_work_deinit(re_work_t *work) {
+    if (work->buf != work->stack_buf) {
+        m_del(char, work->buf, work->size);
+    }
+}
+
+static int re_exec_prog(mp_obj_re_t *self, Subject *subj, const char **caps, int caps_num, bool is_anchored, re_work_t *work) {
+    return re1_5_pikevm(&self->re, subj, caps, caps_num, is_anchored, work->buf);
+}
+
+#else
+
+typedef void *re_work_t;
+#define re_work_init(work, self, caps_num)
+#define re_work_deinit(work)
+
+static int re_exec_prog(mp_obj_re_t *self, Subject *subj, const char **caps, int caps_num, bool is_anchored, re_work_t *work) {
+    (void)work;
+    return re1_5_recursiveloopprog(&self->re, subj, caps, caps_num, is_anchored);
+}
+
+#endif
+
+static int re_exec(mp_obj_re_t *self, Subject *subj, const char **caps, int caps_num, bool is_anchored, re_work_t *work) {
+    #if !MICROPY_ENABLE_DYNRUNTIME
+    if (self->literal_len >= 0) {
+        // The pattern is a plain string, stored after the program, so look
+        // for it directly.  It has no groups, so caps_num is 2.
+        const char *literal = self->re.insts + self->re.bytelen;
+        size_t len = subj->end - subj->begin;
+        const char *found = NULL;
+        if (!is_anchored) {
+            found = (const char *)find_subbytes((const byte *)subj->begin, len, (const byte *)literal, self->literal_len, 1);
+        } else if (len >= (size_t)self->literal_len && memcmp(subj->begin, literal, self->literal_len) == 0) {
+            found = subj->begin;
+        }
+        if (found == NULL) {
+            return 0;
+        }
+        caps[0] = found;
+        caps[1] = found + self->literal_len;
+        return 1;
+    }
+    #endif
+    return re_exec_prog(self, subj, caps, caps_num, is_anchored, work);
+}
+
 // Note: this function can't be named re_exec because it may clash with system headers, eg on FreeBSD
 static mp_obj_t re_exec_helper(bool is_anchored, uint n_args, const mp_obj_t *args) {
     (void)n_args;
@@ -211,7 +286,10 @@ static mp_obj_t re_exec_helper(bool is_anchored, uint n_args, const mp_obj_t *ar
     mp_obj_match_t *match = m_new_obj_var(mp_obj_match_t, caps, char *, caps_num);
     // cast is a workaround for a bug in msvc: it treats const char** as a const pointer instead of a pointer to pointer to const char
     memset((char *)match->caps, 0, caps_num * sizeof(char *));
-    int res = re1_5_recursiveloopprog(&self->re, &subj, match->caps, caps_num, is_anchored);
+    re_work_t work;
+    re_work_init(&work, self, caps_num);
+    int res = re_exec(self, &subj, match->caps, caps_num, is_anchored, &work);
+    re_work_deinit(&work);
     if (res == 0) {
         m_del_var(mp_obj_match_t, caps, char *, caps_num, match);
         return mp_const_none;
@@ -249,10 +327,12 @@ static mp_obj_t re_split(size_t n_args, const mp_obj_t *args) {
 
     mp_obj_t retval = mp_obj_new_list(0, NULL);
     const char **caps = mp_local_alloc(caps_num * sizeof(char *));
+    re_work_t work;
+    re_work_init(&work, self, caps_num);
     while (true) {
         // cast is a workaround for a bug in msvc: it treats const char** as a const pointer instead of a pointer to pointer to const char
         memset((char **)caps, 0, caps_num * sizeof(char *));
-        int res = re1_5_recursiveloopprog(&self->re, &subj, caps, caps_num, false);
+        int res = re_exec(self, &subj, caps, caps_num, false, &work);
 
         // if we didn't have a match, or had an empty match, it's time to stop
         if (!res || caps[0] == caps[1]) {
@@ -269,6 +349,7 @@ static mp_obj_t re_split(size_t n_args, const mp_obj_t *args) {
             break;
         }
     }
+    re_work_deinit(&work);
     // cast is a workaround for a bug in msvc (see above)
     mp_local_free((char **)caps);
 
@@ -308,11 +389,13 @@ static mp_obj_t re_sub_helper(size_t n_args, const mp_obj_t *args) {
     match->base.type = (mp_obj_type_t *)&match_type;
     match->num_matches = caps_num / 2; // caps_num counts start and end pointers
     match->str = where;
+    re_work_t work;
+    re_work_init(&work, self, caps_num);
 
     for (;;) {
         // cast is a workaround for a bug in msvc: it treats const char** as a const pointer instead of a pointer to pointer to const char
         memset((char *)match->caps, 0, caps_num * sizeof(char *));
-        int res = re1_5_recursiveloopprog(&self->re, &subj, match->caps, caps_num, false);
+        int res = re_exec(self, &subj, match->caps, caps_num, false, &work);
 
         // If we didn't have a match, or had an empty match, it's time to stop
         if (!res || match->caps[0] == match->caps[1]) {
@@ -380,6 +463,7 @@ static mp_obj_t re_sub_helper(size_t n_args, const mp_obj_t *args) {
         }
     }
 
+    re_work_deinit(&work);
     mp_local_free(match);
 
     if (vstr_return.buf == NULL) {
@@ -422,29 +506,120 @@ static MP_DEFINE_CONST_OBJ_TYPE(
     );
 #endif
 
+// Return the length of the string that the pattern matches if it has no
+// metacharacters, or -1.  The string itself is written to buf if given.
+static int re_literal(const char *re, char *buf) {
+    int len = 0;
+    for (; *re; ++re, ++len) {
+        if (strchr(".[()?*+|^$", *re) != NULL) {
+            return -1;
+        }
+        if (*re == '\\') {
+            ++re;
+            if (*re == '\0' || strchr("dDsSwW", *re) != NULL) {
+                return -1;
+            }
+        }
+        if (buf != NULL) {
+            buf[len] = *re;
+        }
+    }
+    return len;
+}
+
+#if MICROPY_PY_RE_CACHE_SIZE
+
+// Patterns compiled without flags by re.compile, and by the module-level
+// functions, are kept in a cache with the most recently used first, so that
+// calling re.match etc with the same pattern string doesn't compile it again.
+// Without a GIL the cache could be updated by two threads at once, so it is
+// not used then.
+
+static bool re_cache_usable(void) {
+    #if MICROPY_PY_THREAD_OBJ_LOCK
+    return !MP_STATE_VM(obj_lock_active);
+    #else
+    return true;
+    #endif
+}
+
+static mp_obj_t re_cache_lookup(mp_obj_t pattern, mp_int_t flags) {
+    mp_obj_t *cache = MP_STATE_VM(re_cache);
+    size_t len;
+    const char *str = mp_obj_str_get_data(pattern, &len);
+    for (size_t i = 0; i < MICROPY_PY_RE_CACHE_SIZE && cache[i] != MP_OBJ_NULL; ++i) {
+        mp_obj_re_t *o = MP_OBJ_TO_PTR(cache[i]);
+        if (o->flags != flags) {
+            continue;
+        }
+        if (o->pattern != pattern) {
+            size_t o_len;
+            const char *o_str = mp_obj_str_get_data(o->pattern, &o_len);
+            if (o_len != len || memcmp(o_str, str, len) != 0) {
+                continue;
+            }
+        }
+        // move the entry to the front
+        mp_obj_t found = cache[i];
+        memmove(&cache[1], &cache[0], i * sizeof(mp_obj_t));
+        cache[0] = found;
+        return found;
+    }
+    return MP_OBJ_NULL;
+}
+
+static void re_cache_insert(mp_obj_t re) {
+    mp_obj_t *cache = MP_STATE_VM(re_cache);
+    memmove(&cache[1], &cache[0], (MICROPY_PY_RE_CACHE_SIZE - 1) * sizeof(mp_obj_t));
+    cache[0] = re;
+}
+
+#endif
+
 static mp_obj_t mod_re_compile(size_t n_args, const mp_obj_t *args) {
-    (void)n_args;
+    mp_int_t flags = 0;
+    if (n_args > 1) {
+        flags = mp_obj_get_int(args[1]);
+    }
+    #if MICROPY_PY_RE_CACHE_SIZE
+    // compiling with DEBUG must dump the program every time
+    bool use_cache = !(flags & FLAG_DEBUG) && re_cache_usable();
+    if (use_cache) {
+        mp_obj_t o = re_cache_lookup(args[0], flags);
+        if (o != MP_OBJ_NULL) {
+            return o;
+        }
+    }
+    #endif
     const char *re_str = mp_obj_str_get_str(args[0]);
     int size = re1_5_sizecode(re_str);
     if (size == -1) {
         goto error;
     }
-    mp_obj_re_t *o = mp_obj_malloc_var(mp_obj_re_t, re.insts, char, size, (mp_obj_type_t *)&re_type);
-    #if MICROPY_PY_RE_DEBUG
-    int flags = 0;
-    if (n_args > 1) {
-        flags = mp_obj_get_int(args[1]);
-    }
-    #endif
+    int literal_len = re_literal(re_str, NULL);
+    mp_obj_re_t *o = mp_obj_malloc_var(mp_obj_re_t, re.insts, char, size + MAX(literal_len, 0), (mp_obj_type_t *)&re_type);
     int error = re1_5_compilecode(&o->re, re_str);
     if (error != 0) {
     error:
         mp_raise_ValueError(MP_ERROR_TEXT("error in regex"));
     }
+    o->literal_len = literal_len;
+    if (literal_len >= 0) {
+        re_literal(re_str, o->re.insts + o->re.bytelen);
+    }
     #if MICROPY_PY_RE_DEBUG
     if (flags & FLAG_DEBUG) {
         re1_5_dumpcode(&o->re);
     }
+    #else
+    (void)flags;
+    #endif
+    #if MICROPY_PY_RE_CACHE_SIZE
+    o->pattern = args[0];
+    o->flags = flags;
+    if (use_cache) {
+        re_cache_insert(MP_OBJ_FROM_PTR(o));
+    }
     #endif
     return MP_OBJ_FROM_PTR(o);
 }
@@ -472,6 +647,10 @@ const mp_obj_module_t mp_module_re = {
 };
 
 MP_REGISTER_EXTENSIBLE_MODULE(MP_QSTR_re, mp_module_re);
+
+#if MICROPY_PY_RE_CACHE_SIZE
+MP_REGISTER_ROOT_POINTER(mp_obj_t re_cache[MICROPY_PY_RE_CACHE_SIZE]);
+#endif
 #endif
 
 // Source files #include'd here to make sure they're compiled in
@@ -480,7 +659,11 @@ MP_REGISTER_EXTENSIBLE_MODULE(MP_QSTR_re, mp_module_re);
 #define re1_5_fatal(x) assert(!x)
 
 #include "lib/re1.5/compilecode.c"
+#if MICROPY_PY_RE_PIKEVM
+#include "lib/re1.5/pikevm.c"
+#else
 #include "lib/re1.5/recursiveloop.c"
+#endif
 #include "lib/re1.5/charclass.c"
 
 #if MICROPY_PY_RE_DEBUG
@@ -0,0 +1,255 @@
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#include "re1.5.h"
+
+// A Pike VM runs all possible threads of the program in lockstep over the
+// subject, so it takes time linear in the length of the subject and memory
+// bounded by the size of the program.  Threads are kept in priority order
+// and each instruction is entered at most once per subject position, which
+// gives the same (leftmost-first) matches as the backtracking engines.
+
+typedef struct PikeStack PikeStack;
+
+struct PikeStack
+{
+	const char *pc;
+	const char *old;
+	int slot;	// >= 0 to restore subp[slot] to old, -1 to enter pc
+};
+
+typedef struct PikeVM PikeVM;
+
+struct PikeVM
+{
+	ByteProg *prog;
+	Subject *input;
+	int nsubp;
+	int stride;	// each thread is a pc followed by nsubp saved pointers
+	const char **caps;
+	PikeStack *stack;
+	unsigned int *marks;
+	unsigned int gen;
+};
+
+// Return the number of instructions that a thread can wait at, which are
+// those that consume input, and Match.
+static int
+countthreads(ByteProg *prog)
+{
+	const char *pc = prog->insts, *end = pc + prog->bytelen;
+	int n = 0;
+
+	while(pc < end) {
+		switch(*pc) {
+		case Class:
+		case ClassNot:
+			n++;
+			pc += 2 + (unsigned char)pc[1] * 2;
+			continue;
+		case Char:
+		case NamedClass:
+			n++;
+			pc += 2;
+			continue;
+		case Any:
+		case Match:
+			n++;
+			break;
+		case Jmp:
+		case Split:
+		case RSplit:
+		case Save:
+			pc++;
+			break;
+		}
+		pc++;
+	}
+	return n;
+}
+
+int
+re1_5_pikevm_worksize(ByteProg *prog, int nsubp)
+{
+	int nthreads = countthreads(prog);
+
+	// two thread lists, the captures being built, the stack and the marks
+	return (2 * nthreads * (nsubp + 1) + nsubp) * sizeof(const char*)
+		+ (prog->len - nthreads + 1) * sizeof(PikeStack)
+		+ prog->bytelen * sizeof(unsigned int);
+}
+
+// Add the thread starting at pc to the list, following jumps, splits,
+// saves and assertions at position sp to reach the instructions that
+// consume input or match.
+static void
+addthread(PikeVM *vm, const char **list, int *n, const char *pc, const char **caps, const char *sp)
+{
+	PikeStack *stack = vm->stack;
+	const char **t;
+	int nstack = 0;
+	int off;
+
+	if(caps)
+		memcpy((char*)vm->caps, (char*)caps, vm->nsubp * sizeof(const char*));
+	else
+		memset((char*)vm->caps, 0, vm->nsubp * sizeof(const char*));
+	stack[nstack].pc = pc;
+	stack[nstack++].slot = -1;
+	while(nstack > 0) {
+		PikeStack *e = &stack[--nstack];
+		if(e->slot >= 0) {
+			vm->caps[e->slot] = e->old;
+			continue;
+		}
+		pc = e->pc;
+		for(;;) {
+			off = pc - vm->prog->insts;
+			if(vm->marks[off] == vm->gen)
+				break;
+			vm->marks[off] = vm->gen;
+			switch(*pc) {
+			case Jmp:
+				pc += 2 + (signed char)pc[1];
+				continue;
+			case Split:
+				stack[nstack].pc = pc + 2 + (signed char)pc[1];
+				stack[nstack++].slot = -1;
+				pc += 2;
+				continue;
+			case RSplit:
+				stack[nstack].pc = pc + 2;
+				stack[nstack++].slot = -1;
+				pc += 2 + (signed char)pc[1];
+				continue;
+			case Save:
+				off = (unsigned char)pc[1];
+				if(off < vm->nsubp) {
+					stack[nstack].old = vm->caps[off];
+					stack[nstack++].slot = off;
+					vm->caps[off] = sp;
+				}
+				pc += 2;
+				continue;
+			case Bol:
+				if(sp != vm->input->begin_line)
+					break;
+				pc++;
+				continue;
+			case Eol:
+				if(sp != vm->input->end)
+					break;
+				pc++;
+				continue;
+			default:
+				t = list + *n * vm->stride;
+				t[0] = pc;
+				memcpy((char*)(t + 1), (char*)vm->caps, vm->nsubp * sizeof(const char*));
+				++*n;
+				break;
+			}
+			break;
+		}
+	}
+}
+
+// Return the byte that every match must start with, or -1.
+static int
+firstchar(const char *pc)
+{
+	while(*pc == Save)
+		pc += 2;
+	return *pc == Char ? (unsigned char)pc[1] : -1;
+}
+
+int
+re1_5_pikevm(ByteProg *prog, Subject *input, const char **subp, int nsubp, int is_anchored, void *work)
+{
+	PikeVM vm;
+	const char **clist, **nlist, **t;
+	const char *sp, *pc, *next;
+	char *start;
+	int nthreads, first, i, nc, nn, matched;
+
+	vm.prog = prog;
+	vm.input = input;
+	vm.nsubp = nsubp;
+	vm.stride = nsubp + 1;
+	nthreads = countthreads(prog);
+	clist = work;
+	nlist = clist + nthreads * vm.stride;
+	vm.caps = nlist + nthreads * vm.stride;
+	vm.stack = (PikeStack*)(vm.caps + nsubp);
+	vm.marks = (unsigned int*)(vm.stack + prog->len - nthreads + 1);
+	memset(vm.marks, 0, prog->bytelen * sizeof(unsigned int));
+	vm.gen = 1;
+
+	start = HANDLE_ANCHORED(prog->insts, 1);
+	first = is_anchored ? -1 : firstchar(start);
+	nc = 0;
+	matched = 0;
+	for(sp = input->begin;; sp++) {
+		if(nc == 0) {
+			if(matched || (is_anchored && sp != input->begin))
+				break;
+			if(first >= 0) {
+				// skip to where a match could start
+				sp = memchr(sp, first, input->end - sp);
+				if(sp == nil)
+					break;
+			}
+		}
+		if(!matched && (!is_anchored || sp == input->begin))
+			addthread(&vm, clist, &nc, start, nil, sp);
+
+		if(++vm.gen == 0) {
+			memset(vm.marks, 0, prog->bytelen * sizeof(unsigned int));
+			vm.gen = 1;
+		}
+		nn = 0;
+		for(i = 0; i < nc; i++) {
+			t = clist + i * vm.stride;
+			pc = t[0];
+			if(*pc == Match) {
+				// lower priority threads can't give a better match
+				memcpy((char*)subp, (char*)(t + 1), nsubp * sizeof(const char*));
+				matched = 1;
+				break;
+			}
+			if(sp >= input->end)
+				continue;
+			switch(*pc) {
+			case Char:
+				if(*sp != pc[1])
+					continue;
+				next = pc + 2;
+				break;
+			case Any:
+				next = pc + 1;
+				break;
+			case Class:
+			case ClassNot:
+				if(!_re1_5_classmatch(pc + 1, sp))
+					continue;
+				next = pc + 2 + (unsigned char)pc[1] * 2;
+				break;
+			case NamedClass:
+				if(!_re1_5_namedclassmatch(pc + 1, sp))
+					continue;
+				next = pc + 2;
+				break;
+			default:
+				re1_5_fatal("pikevm");
+				continue;
+			}
+			addthread(&vm, nlist, &nn, next, t + 1, sp + 1);
+		}
+		if(sp >= input->end)
+			break;
+		t = clist;
+		clist = nlist;
+		nlist = t;
+		nc = nn;
+	}
+	return matched;
+}
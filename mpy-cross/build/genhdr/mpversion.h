@@ -0,0 +1,4 @@
+// This file was generated by py/makeversionhdr.py
+#define MICROPY_GIT_TAG "a327bd5-dirty"
+#define MICROPY_GIT_HASH "a327bd5"
+#define MICROPY_BUILD_DATE "2026-10-18"
@@ -0,0 +1,1043 @@
+//
+// Content for MICROPY_MODULE_FROZEN_STR
+//
+#include <stdint.h>
+#define MP_FROZEN_STR_NAMES \
+"frzstr1.py\0" \
+"frzstr_pkg1/__init__.py\0" \
+"frzstr_pkg2/mod.py\0" \
+
+const uint32_t mp_frozen_str_sizes[] = { 17, 75, 90, 0 };
+const char mp_frozen_str_content[] = {
+"print(\"frzstr1\")\n\0"
+"# test frozen package with __init__.py\nprint(\"frzstr_pkg1.__init__\")\nx = 1\n\0"
+"# test frozen package without __init__.py\nprint(\"frzstr_pkg2.mod\")\n\n\nclass Foo:\n    x = 1\n\0"
+"\0"
+};
+
+//
+// Content for MICROPY_MODULE_FROZEN_MPY
+//
+#include "py/mpconfig.h"
+#include "py/objint.h"
+#include "py/objstr.h"
+#include "py/emitglue.h"
+#include "py/nativeglue.h"
+
+#if MICROPY_LONGINT_IMPL != 2
+#error "incompatible MICROPY_LONGINT_IMPL"
+#endif
+
+#if MPZ_DIG_SIZE != 16
+#error "incompatible MPZ_DIG_SIZE"
+#endif
+
+#if MICROPY_PY_BUILTINS_FLOAT
+typedef struct _mp_obj_float_t {
+    mp_obj_base_t base;
+    mp_float_t value;
+} mp_obj_float_t;
+#endif
+
+#if MICROPY_PY_BUILTINS_COMPLEX
+typedef struct _mp_obj_complex_t {
+    mp_obj_base_t base;
+    mp_float_t real;
+    mp_float_t imag;
+} mp_obj_complex_t;
+#endif
+
+enum {
+    MP_QSTR__0x0a_X = MP_QSTRnumber_of,
+    MP_QSTR__0x1b_,
+    MP_QSTR_Foo,
+    MP_QSTR_NULL,
+    MP_QSTR__backslash_,
+    MP_QSTR_frozentest_dot_py,
+    MP_QSTR_frzmpy1,
+    MP_QSTR_frzmpy1_dot_py,
+    MP_QSTR_frzmpy2_dot_py,
+    MP_QSTR_frzmpy3_dot_py,
+    MP_QSTR_frzmpy4_dot_py,
+    MP_QSTR_frzmpy_pkg1_dot___init__,
+    MP_QSTR_frzmpy_pkg1_slash___init___dot_py,
+    MP_QSTR_frzmpy_pkg2_dot_mod,
+    MP_QSTR_frzmpy_pkg2_slash_mod_dot_py,
+    MP_QSTR_frzqstr_dot_py,
+    MP_QSTR_g,
+    MP_QSTR_i,
+    MP_QSTR_returns_NULL,
+    MP_QSTR_uPy,
+    MP_QSTR_x,
+};
+
+const qstr_hash_t mp_qstr_frozen_const_hashes[] = {
+    27607,
+    46526,
+    47043,
+    43166,
+    46585,
+    20734,
+    37342,
+    64441,
+    28762,
+    62587,
+    26652,
+    38281,
+    46383,
+    12854,
+    23952,
+    18600,
+    46530,
+    46540,
+    9176,
+    24569,
+    46557,
+};
+
+const qstr_len_t mp_qstr_frozen_const_lengths[] = {
+    2,
+    1,
+    3,
+    4,
+    1,
+    13,
+    7,
+    10,
+    10,
+    10,
+    10,
+    20,
+    23,
+    15,
+    18,
+    10,
+    1,
+    1,
+    12,
+    3,
+    1,
+};
+
+extern const qstr_pool_t mp_qstr_const_pool;
+const qstr_pool_t mp_qstr_frozen_const_pool = {
+    &mp_qstr_const_pool, // previous pool
+    MP_QSTRnumber_of, // previous pool size
+    true, // is_sorted
+    10, // allocated entries
+    21, // used entries
+    (qstr_hash_t *)mp_qstr_frozen_const_hashes,
+    (qstr_len_t *)mp_qstr_frozen_const_lengths,
+    {
+        "\x0a\x58",
+        "\x1b",
+        "Foo",
+        "NULL",
+        "\x5c",
+        "frozentest.py",
+        "frzmpy1",
+        "frzmpy1.py",
+        "frzmpy2.py",
+        "frzmpy3.py",
+        "frzmpy4.py",
+        "frzmpy_pkg1.__init__",
+        "frzmpy_pkg1/__init__.py",
+        "frzmpy_pkg2.mod",
+        "frzmpy_pkg2/mod.py",
+        "frzqstr.py",
+        "g",
+        "i",
+        "returns_NULL",
+        "uPy",
+        "x",
+    },
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// frozen module frzqstr
+// - original source file: build-coverage/frozen_mpy/frzqstr.mpy
+// - frozen file name: frzqstr.py
+// - .mpy header: 4d:06:00:1f
+
+// frozen bytecode for file frzqstr.py, scope frzqstr__lt_module_gt_
+static const byte fun_data_frzqstr__lt_module_gt_[10] = {
+    0x00,0x04, // prelude
+    0x01, // names: <module>
+    0x20, // code info
+    0x32,0x00, // MAKE_FUNCTION 0
+    0x16,0x02, // STORE_NAME 'returns_NULL'
+    0x51, // LOAD_CONST_NONE
+    0x63, // RETURN_VALUE
+};
+// child of frzqstr__lt_module_gt_
+// frozen bytecode for file frzqstr.py, scope frzqstr_returns_NULL
+static const byte fun_data_frzqstr_returns_NULL[7] = {
+    0x00,0x04, // prelude
+    0x02, // names: returns_NULL
+    0x40, // code info
+    0x10,0x03, // LOAD_CONST_STRING 'NULL'
+    0x63, // RETURN_VALUE
+};
+#if MICROPY_PERSISTENT_CODE_SAVE
+static const mp_raw_code_truncated_t proto_fun_frzqstr_returns_NULL = {
+    .proto_fun_indicator[0] = MP_PROTO_FUN_INDICATOR_RAW_CODE_0,
+    .proto_fun_indicator[1] = MP_PROTO_FUN_INDICATOR_RAW_CODE_1,
+    .kind = MP_CODE_BYTECODE,
+    .is_generator = 0,
+    .fun_data = fun_data_frzqstr_returns_NULL,
+    .children = NULL,
+    #if MICROPY_PERSISTENT_CODE_SAVE
+    .fun_data_len = 7,
+    .n_children = 0,
+    #if MICROPY_EMIT_MACHINE_CODE
+    .prelude_offset = 0,
+    #endif
+    #if MICROPY_PY_SYS_SETTRACE
+    .line_of_definition = 0,
+    .prelude = {
+        .n_state = 1,
+        .n_exc_stack = 0,
+        .scope_flags = 0,
+        .n_pos_args = 0,
+        .n_kwonly_args = 0,
+        .n_def_pos_args = 0,
+        .qstr_block_name_idx = 2,
+        .line_info = fun_data_frzqstr_returns_NULL + 3,
+        .line_info_top = fun_data_frzqstr_returns_NULL + 4,
+        .opcodes = fun_data_frzqstr_returns_NULL + 4,
+    },
+    #endif
+    #endif
+};
+#else
+#define proto_fun_frzqstr_returns_NULL fun_data_frzqstr_returns_NULL[0]
+#endif
+
+static const mp_raw_code_t *const children_frzqstr__lt_module_gt_[] = {
+    (const mp_raw_code_t *)&proto_fun_frzqstr_returns_NULL,
+};
+
+static const mp_raw_code_truncated_t proto_fun_frzqstr__lt_module_gt_ = {
+    .proto_fun_indicator[0] = MP_PROTO_FUN_INDICATOR_RAW_CODE_0,
+    .proto_fun_indicator[1] = MP_PROTO_FUN_INDICATOR_RAW_CODE_1,
+    .kind = MP_CODE_BYTECODE,
+    .is_generator = 0,
+    .fun_data = fun_data_frzqstr__lt_module_gt_,
+    .children = (void *)&children_frzqstr__lt_module_gt_,
+    #if MICROPY_PERSISTENT_CODE_SAVE
+    .fun_data_len = 10,
+    .n_children = 1,
+    #if MICROPY_EMIT_MACHINE_CODE
+    .prelude_offset = 0,
+    #endif
+    #if MICROPY_PY_SYS_SETTRACE
+    .line_of_definition = 0,
+    .prelude = {
+        .n_state = 1,
+        .n_exc_stack = 0,
+        .scope_flags = 0,
+        .n_pos_args = 0,
+        .n_kwonly_args = 0,
+        .n_def_pos_args = 0,
+        .qstr_block_name_idx = 1,
+        .line_info = fun_data_frzqstr__lt_module_gt_ + 3,
+        .line_info_top = fun_data_frzqstr__lt_module_gt_ + 4,
+        .opcodes = fun_data_frzqstr__lt_module_gt_ + 4,
+    },
+    #endif
+    #endif
+};
+
+static const qstr_short_t const_qstr_table_data_frzqstr[4] = {
+    MP_QSTR_frzqstr_dot_py,
+    MP_QSTR__lt_module_gt_,
+    MP_QSTR_returns_NULL,
+    MP_QSTR_NULL,
+};
+
+static const mp_frozen_module_t frozen_module_frzqstr = {
+    .constants = {
+        .qstr_table = (qstr_short_t *)&const_qstr_table_data_frzqstr,
+        .obj_table = NULL,
+    },
+    .proto_fun = &proto_fun_frzqstr__lt_module_gt_,
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// frozen module frzmpy3
+// - original source file: build-coverage/frozen_mpy/frzmpy3.mpy
+// - frozen file name: frzmpy3.py
+// - .mpy header: 4d:06:00:1f
+
+// frozen bytecode for file frzmpy3.py, scope frzmpy3__lt_module_gt_
+static const byte fun_data_frzmpy3__lt_module_gt_[41] = {
+    0x10,0x0a, // prelude
+    0x01, // names: <module>
+    0x40,0x27,0x27,0x2b, // code info
+    0x11,0x05, // LOAD_NAME 'print'
+    0x10,0x02, // LOAD_CONST_STRING '\\'
+    0x34,0x01, // CALL_FUNCTION 1
+    0x59, // POP_TOP
+    0x11,0x05, // LOAD_NAME 'print'
+    0x10,0x03, // LOAD_CONST_STRING '\nX'
+    0x34,0x01, // CALL_FUNCTION 1
+    0x59, // POP_TOP
+    0x11,0x05, // LOAD_NAME 'print'
+    0x11,0x06, // LOAD_NAME 'repr'
+    0x10,0x04, // LOAD_CONST_STRING '\x1b'
+    0x34,0x01, // CALL_FUNCTION 1
+    0x34,0x01, // CALL_FUNCTION 1
+    0x59, // POP_TOP
+    0x11,0x05, // LOAD_NAME 'print'
+    0x23,0x00, // LOAD_CONST_OBJ 0
+    0x34,0x01, // CALL_FUNCTION 1
+    0x59, // POP_TOP
+    0x51, // LOAD_CONST_NONE
+    0x63, // RETURN_VALUE
+};
+#if MICROPY_PERSISTENT_CODE_SAVE
+static const mp_raw_code_truncated_t proto_fun_frzmpy3__lt_module_gt_ = {
+    .proto_fun_indicator[0] = MP_PROTO_FUN_INDICATOR_RAW_CODE_0,
+    .proto_fun_indicator[1] = MP_PROTO_FUN_INDICATOR_RAW_CODE_1,
+    .kind = MP_CODE_BYTECODE,
+    .is_generator = 0,
+    .fun_data = fun_data_frzmpy3__lt_module_gt_,
+    .children = NULL,
+    #if MICROPY_PERSISTENT_CODE_SAVE
+    .fun_data_len = 41,
+    .n_children = 0,
+    #if MICROPY_EMIT_MACHINE_CODE
+    .prelude_offset = 0,
+    #endif
+    #if MICROPY_PY_SYS_SETTRACE
+    .line_of_definition = 0,
+    .prelude = {
+        .n_state = 3,
+        .n_exc_stack = 0,
+        .scope_flags = 0,
+        .n_pos_args = 0,
+        .n_kwonly_args = 0,
+        .n_def_pos_args = 0,
+        .qstr_block_name_idx = 1,
+        .line_info = fun_data_frzmpy3__lt_module_gt_ + 3,
+        .line_info_top = fun_data_frzmpy3__lt_module_gt_ + 7,
+        .opcodes = fun_data_frzmpy3__lt_module_gt_ + 7,
+    },
+    #endif
+    #endif
+};
+#else
+#define proto_fun_frzmpy3__lt_module_gt_ fun_data_frzmpy3__lt_module_gt_[0]
+#endif
+
+static const qstr_short_t const_qstr_table_data_frzmpy3[7] = {
+    MP_QSTR_frzmpy3_dot_py,
+    MP_QSTR__lt_module_gt_,
+    MP_QSTR__backslash_,
+    MP_QSTR__0x0a_X,
+    MP_QSTR__0x1b_,
+    MP_QSTR_print,
+    MP_QSTR_repr,
+};
+
+// constants
+static const mp_obj_str_t const_obj_frzmpy3_0 = {{&mp_type_bytes}, 27322, 2, (const byte*)"\x00\xff"};
+
+// constant table
+static const mp_rom_obj_t const_obj_table_data_frzmpy3[1] = {
+    MP_ROM_PTR(&const_obj_frzmpy3_0),
+};
+
+static const mp_frozen_module_t frozen_module_frzmpy3 = {
+    .constants = {
+        .qstr_table = (qstr_short_t *)&const_qstr_table_data_frzmpy3,
+        .obj_table = (mp_obj_t *)&const_obj_table_data_frzmpy3,
+    },
+    .proto_fun = &proto_fun_frzmpy3__lt_module_gt_,
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// frozen module frzmpy4
+// - original source file: build-coverage/frozen_mpy/frzmpy4.mpy
+// - frozen file name: frzmpy4.py
+// - .mpy header: 4d:06:00:1f
+
+// frozen bytecode for file frzmpy4.py, scope frzmpy4__lt_module_gt_
+static const byte fun_data_frzmpy4__lt_module_gt_[46] = {
+    0x18,0x10, // prelude
+    0x01, // names: <module>
+    0x60,0x64,0x20,0x6b,0x20,0x64,0x20, // code info
+    0x32,0x00, // MAKE_FUNCTION 0
+    0x16,0x02, // STORE_NAME 'f'
+    0x11,0x04, // LOAD_NAME 'print'
+    0x11,0x05, // LOAD_NAME '__name__'
+    0x11,0x02, // LOAD_NAME 'f'
+    0x34,0x00, // CALL_FUNCTION 0
+    0x34,0x02, // CALL_FUNCTION 2
+    0x59, // POP_TOP
+    0x32,0x01, // MAKE_FUNCTION 1
+    0x16,0x03, // STORE_NAME 'g'
+    0x11,0x04, // LOAD_NAME 'print'
+    0x11,0x05, // LOAD_NAME '__name__'
+    0x11,0x06, // LOAD_NAME 'next'
+    0x11,0x03, // LOAD_NAME 'g'
+    0x34,0x00, // CALL_FUNCTION 0
+    0x34,0x01, // CALL_FUNCTION 1
+    0x34,0x02, // CALL_FUNCTION 2
+    0x59, // POP_TOP
+    0x51, // LOAD_CONST_NONE
+    0x63, // RETURN_VALUE
+};
+// child of frzmpy4__lt_module_gt_
+// frozen bytecode for file frzmpy4.py, scope frzmpy4_f
+static const byte fun_data_frzmpy4_f[7] = {
+    0x00,0x06, // prelude
+    0x02, // names: f
+    0x60,0x20, // code info
+    0x81, // LOAD_CONST_SMALL_INT 1
+    0x63, // RETURN_VALUE
+};
+#if MICROPY_PERSISTENT_CODE_SAVE
+static const mp_raw_code_truncated_t proto_fun_frzmpy4_f = {
+    .proto_fun_indicator[0] = MP_PROTO_FUN_INDICATOR_RAW_CODE_0,
+    .proto_fun_indicator[1] = MP_PROTO_FUN_INDICATOR_RAW_CODE_1,
+    .kind = MP_CODE_BYTECODE,
+    .is_generator = 0,
+    .fun_data = fun_data_frzmpy4_f,
+    .children = NULL,
+    #if MICROPY_PERSISTENT_CODE_SAVE
+    .fun_data_len = 7,
+    .n_children = 0,
+    #if MICROPY_EMIT_MACHINE_CODE
+    .prelude_offset = 0,
+    #endif
+    #if MICROPY_PY_SYS_SETTRACE
+    .line_of_definition = 0,
+    .prelude = {
+        .n_state = 1,
+        .n_exc_stack = 0,
+        .scope_flags = 0,
+        .n_pos_args = 0,
+        .n_kwonly_args = 0,
+        .n_def_pos_args = 0,
+        .qstr_block_name_idx = 2,
+        .line_info = fun_data_frzmpy4_f + 3,
+        .line_info_top = fun_data_frzmpy4_f + 5,
+        .opcodes = fun_data_frzmpy4_f + 5,
+    },
+    #endif
+    #endif
+};
+#else
+#define proto_fun_frzmpy4_f fun_data_frzmpy4_f[0]
+#endif
+
+// child of frzmpy4__lt_module_gt_
+// frozen bytecode for file frzmpy4.py, scope frzmpy4_g
+static const byte fun_data_frzmpy4_g[11] = {
+    0x80,0x40,0x06, // prelude
+    0x03, // names: g
+    0x80,0x0c, // code info
+    0x82, // LOAD_CONST_SMALL_INT 2
+    0x67, // YIELD_VALUE
+    0x59, // POP_TOP
+    0x51, // LOAD_CONST_NONE
+    0x63, // RETURN_VALUE
+};
+#if MICROPY_PERSISTENT_CODE_SAVE
+static const mp_raw_code_truncated_t proto_fun_frzmpy4_g = {
+    .proto_fun_indicator[0] = MP_PROTO_FUN_INDICATOR_RAW_CODE_0,
+    .proto_fun_indicator[1] = MP_PROTO_FUN_INDICATOR_RAW_CODE_1,
+    .kind = MP_CODE_BYTECODE,
+    .is_generator = 1,
+    .fun_data = fun_data_frzmpy4_g,
+    .children = NULL,
+    #if MICROPY_PERSISTENT_CODE_SAVE
+    .fun_data_len = 11,
+    .n_children = 0,
+    #if MICROPY_EMIT_MACHINE_CODE
+    .prelude_offset = 0,
+    #endif
+    #if MICROPY_PY_SYS_SETTRACE
+    .line_of_definition = 0,
+    .prelude = {
+        .n_state = 1,
+        .n_exc_stack = 0,
+        .scope_flags = 1,
+        .n_pos_args = 0,
+        .n_kwonly_args = 0,
+        .n_def_pos_args = 0,
+        .qstr_block_name_idx = 3,
+        .line_info = fun_data_frzmpy4_g + 4,
+        .line_info_top = fun_data_frzmpy4_g + 6,
+        .opcodes = fun_data_frzmpy4_g + 6,
+    },
+    #endif
+    #endif
+};
+#else
+#define proto_fun_frzmpy4_g fun_data_frzmpy4_g[0]
+#endif
+
+static const mp_raw_code_t *const children_frzmpy4__lt_module_gt_[] = {
+    (const mp_raw_code_t *)&proto_fun_frzmpy4_f,
+    (const mp_raw_code_t *)&proto_fun_frzmpy4_g,
+};
+
+static const mp_raw_code_truncated_t proto_fun_frzmpy4__lt_module_gt_ = {
+    .proto_fun_indicator[0] = MP_PROTO_FUN_INDICATOR_RAW_CODE_0,
+    .proto_fun_indicator[1] = MP_PROTO_FUN_INDICATOR_RAW_CODE_1,
+    .kind = MP_CODE_BYTECODE,
+    .is_generator = 0,
+    .fun_data = fun_data_frzmpy4__lt_module_gt_,
+    .children = (void *)&children_frzmpy4__lt_module_gt_,
+    #if MICROPY_PERSISTENT_CODE_SAVE
+    .fun_data_len = 46,
+    .n_children = 2,
+    #if MICROPY_EMIT_MACHINE_CODE
+    .prelude_offset = 0,
+    #endif
+    #if MICROPY_PY_SYS_SETTRACE
+    .line_of_definition = 0,
+    .prelude = {
+        .n_state = 4,
+        .n_exc_stack = 0,
+        .scope_flags = 0,
+        .n_pos_args = 0,
+        .n_kwonly_args = 0,
+        .n_def_pos_args = 0,
+        .qstr_block_name_idx = 1,
+        .line_info = fun_data_frzmpy4__lt_module_gt_ + 3,
+        .line_info_top = fun_data_frzmpy4__lt_module_gt_ + 10,
+        .opcodes = fun_data_frzmpy4__lt_module_gt_ + 10,
+    },
+    #endif
+    #endif
+};
+
+static const qstr_short_t const_qstr_table_data_frzmpy4[7] = {
+    MP_QSTR_frzmpy4_dot_py,
+    MP_QSTR__lt_module_gt_,
+    MP_QSTR_f,
+    MP_QSTR_g,
+    MP_QSTR_print,
+    MP_QSTR___name__,
+    MP_QSTR_next,
+};
+
+static const mp_frozen_module_t frozen_module_frzmpy4 = {
+    .constants = {
+        .qstr_table = (qstr_short_t *)&const_qstr_table_data_frzmpy4,
+        .obj_table = NULL,
+    },
+    .proto_fun = &proto_fun_frzmpy4__lt_module_gt_,
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// frozen module frzmpy2
+// - original source file: build-coverage/frozen_mpy/frzmpy2.mpy
+// - frozen file name: frzmpy2.py
+// - .mpy header: 4d:06:00:1f
+
+// frozen bytecode for file frzmpy2.py, scope frzmpy2__lt_module_gt_
+static const byte fun_data_frzmpy2__lt_module_gt_[6] = {
+    0x00,0x02, // prelude
+    0x01, // names: <module>
+     // code info
+    0x11,0x02, // LOAD_NAME 'ZeroDivisionError'
+    0x65, // RAISE_OBJ
+};
+#if MICROPY_PERSISTENT_CODE_SAVE
+static const mp_raw_code_truncated_t proto_fun_frzmpy2__lt_module_gt_ = {
+    .proto_fun_indicator[0] = MP_PROTO_FUN_INDICATOR_RAW_CODE_0,
+    .proto_fun_indicator[1] = MP_PROTO_FUN_INDICATOR_RAW_CODE_1,
+    .kind = MP_CODE_BYTECODE,
+    .is_generator = 0,
+    .fun_data = fun_data_frzmpy2__lt_module_gt_,
+    .children = NULL,
+    #if MICROPY_PERSISTENT_CODE_SAVE
+    .fun_data_len = 6,
+    .n_children = 0,
+    #if MICROPY_EMIT_MACHINE_CODE
+    .prelude_offset = 0,
+    #endif
+    #if MICROPY_PY_SYS_SETTRACE
+    .line_of_definition = 0,
+    .prelude = {
+        .n_state = 1,
+        .n_exc_stack = 0,
+        .scope_flags = 0,
+        .n_pos_args = 0,
+        .n_kwonly_args = 0,
+        .n_def_pos_args = 0,
+        .qstr_block_name_idx = 1,
+        .line_info = fun_data_frzmpy2__lt_module_gt_ + 3,
+        .line_info_top = fun_data_frzmpy2__lt_module_gt_ + 3,
+        .opcodes = fun_data_frzmpy2__lt_module_gt_ + 3,
+    },
+    #endif
+    #endif
+};
+#else
+#define proto_fun_frzmpy2__lt_module_gt_ fun_data_frzmpy2__lt_module_gt_[0]
+#endif
+
+static const qstr_short_t const_qstr_table_data_frzmpy2[3] = {
+    MP_QSTR_frzmpy2_dot_py,
+    MP_QSTR__lt_module_gt_,
+    MP_QSTR_ZeroDivisionError,
+};
+
+static const mp_frozen_module_t frozen_module_frzmpy2 = {
+    .constants = {
+        .qstr_table = (qstr_short_t *)&const_qstr_table_data_frzmpy2,
+        .obj_table = NULL,
+    },
+    .proto_fun = &proto_fun_frzmpy2__lt_module_gt_,
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// frozen module frzmpy1
+// - original source file: build-coverage/frozen_mpy/frzmpy1.mpy
+// - frozen file name: frzmpy1.py
+// - .mpy header: 4d:06:00:1f
+
+// frozen bytecode for file frzmpy1.py, scope frzmpy1__lt_module_gt_
+static const byte fun_data_frzmpy1__lt_module_gt_[12] = {
+    0x08,0x02, // prelude
+    0x01, // names: <module>
+     // code info
+    0x11,0x03, // LOAD_NAME 'print'
+    0x10,0x02, // LOAD_CONST_STRING 'frzmpy1'
+    0x34,0x01, // CALL_FUNCTION 1
+    0x59, // POP_TOP
+    0x51, // LOAD_CONST_NONE
+    0x63, // RETURN_VALUE
+};
+#if MICROPY_PERSISTENT_CODE_SAVE
+static const mp_raw_code_truncated_t proto_fun_frzmpy1__lt_module_gt_ = {
+    .proto_fun_indicator[0] = MP_PROTO_FUN_INDICATOR_RAW_CODE_0,
+    .proto_fun_indicator[1] = MP_PROTO_FUN_INDICATOR_RAW_CODE_1,
+    .kind = MP_CODE_BYTECODE,
+    .is_generator = 0,
+    .fun_data = fun_data_frzmpy1__lt_module_gt_,
+    .children = NULL,
+    #if MICROPY_PERSISTENT_CODE_SAVE
+    .fun_data_len = 12,
+    .n_children = 0,
+    #if MICROPY_EMIT_MACHINE_CODE
+    .prelude_offset = 0,
+    #endif
+    #if MICROPY_PY_SYS_SETTRACE
+    .line_of_definition = 0,
+    .prelude = {
+        .n_state = 2,
+        .n_exc_stack = 0,
+        .scope_flags = 0,
+        .n_pos_args = 0,
+        .n_kwonly_args = 0,
+        .n_def_pos_args = 0,
+        .qstr_block_name_idx = 1,
+        .line_info = fun_data_frzmpy1__lt_module_gt_ + 3,
+        .line_info_top = fun_data_frzmpy1__lt_module_gt_ + 3,
+        .opcodes = fun_data_frzmpy1__lt_module_gt_ + 3,
+    },
+    #endif
+    #endif
+};
+#else
+#define proto_fun_frzmpy1__lt_module_gt_ fun_data_frzmpy1__lt_module_gt_[0]
+#endif
+
+static const qstr_short_t const_qstr_table_data_frzmpy1[4] = {
+    MP_QSTR_frzmpy1_dot_py,
+    MP_QSTR__lt_module_gt_,
+    MP_QSTR_frzmpy1,
+    MP_QSTR_print,
+};
+
+static const mp_frozen_module_t frozen_module_frzmpy1 = {
+    .constants = {
+        .qstr_table = (qstr_short_t *)&const_qstr_table_data_frzmpy1,
+        .obj_table = NULL,
+    },
+    .proto_fun = &proto_fun_frzmpy1__lt_module_gt_,
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// frozen module frzmpy_pkg1___init__
+// - original source file: build-coverage/frozen_mpy/frzmpy_pkg1/__init__.mpy
+// - frozen file name: frzmpy_pkg1/__init__.py
+// - .mpy header: 4d:06:00:1f
+
+// frozen bytecode for file frzmpy_pkg1/__init__.py, scope frzmpy_pkg1___init____lt_module_gt_
+static const byte fun_data_frzmpy_pkg1___init____lt_module_gt_[17] = {
+    0x08,0x06, // prelude
+    0x01, // names: <module>
+    0x20,0x27, // code info
+    0x11,0x02, // LOAD_NAME 'print'
+    0x23,0x00, // LOAD_CONST_OBJ 0
+    0x34,0x01, // CALL_FUNCTION 1
+    0x59, // POP_TOP
+    0x81, // LOAD_CONST_SMALL_INT 1
+    0x16,0x03, // STORE_NAME 'x'
+    0x51, // LOAD_CONST_NONE
+    0x63, // RETURN_VALUE
+};
+#if MICROPY_PERSISTENT_CODE_SAVE
+static const mp_raw_code_truncated_t proto_fun_frzmpy_pkg1___init____lt_module_gt_ = {
+    .proto_fun_indicator[0] = MP_PROTO_FUN_INDICATOR_RAW_CODE_0,
+    .proto_fun_indicator[1] = MP_PROTO_FUN_INDICATOR_RAW_CODE_1,
+    .kind = MP_CODE_BYTECODE,
+    .is_generator = 0,
+    .fun_data = fun_data_frzmpy_pkg1___init____lt_module_gt_,
+    .children = NULL,
+    #if MICROPY_PERSISTENT_CODE_SAVE
+    .fun_data_len = 17,
+    .n_children = 0,
+    #if MICROPY_EMIT_MACHINE_CODE
+    .prelude_offset = 0,
+    #endif
+    #if MICROPY_PY_SYS_SETTRACE
+    .line_of_definition = 0,
+    .prelude = {
+        .n_state = 2,
+        .n_exc_stack = 0,
+        .scope_flags = 0,
+        .n_pos_args = 0,
+        .n_kwonly_args = 0,
+        .n_def_pos_args = 0,
+        .qstr_block_name_idx = 1,
+        .line_info = fun_data_frzmpy_pkg1___init____lt_module_gt_ + 3,
+        .line_info_top = fun_data_frzmpy_pkg1___init____lt_module_gt_ + 5,
+        .opcodes = fun_data_frzmpy_pkg1___init____lt_module_gt_ + 5,
+    },
+    #endif
+    #endif
+};
+#else
+#define proto_fun_frzmpy_pkg1___init____lt_module_gt_ fun_data_frzmpy_pkg1___init____lt_module_gt_[0]
+#endif
+
+static const qstr_short_t const_qstr_table_data_frzmpy_pkg1___init__[4] = {
+    MP_QSTR_frzmpy_pkg1_slash___init___dot_py,
+    MP_QSTR__lt_module_gt_,
+    MP_QSTR_print,
+    MP_QSTR_x,
+};
+
+// constants
+
+// constant table
+static const mp_rom_obj_t const_obj_table_data_frzmpy_pkg1___init__[1] = {
+    MP_ROM_QSTR(MP_QSTR_frzmpy_pkg1_dot___init__),
+};
+
+static const mp_frozen_module_t frozen_module_frzmpy_pkg1___init__ = {
+    .constants = {
+        .qstr_table = (qstr_short_t *)&const_qstr_table_data_frzmpy_pkg1___init__,
+        .obj_table = (mp_obj_t *)&const_obj_table_data_frzmpy_pkg1___init__,
+    },
+    .proto_fun = &proto_fun_frzmpy_pkg1___init____lt_module_gt_,
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// frozen module frzmpy_pkg2_mod
+// - original source file: build-coverage/frozen_mpy/frzmpy_pkg2/mod.mpy
+// - frozen file name: frzmpy_pkg2/mod.py
+// - .mpy header: 4d:06:00:1f
+
+// frozen bytecode for file frzmpy_pkg2/mod.py, scope frzmpy_pkg2_mod__lt_module_gt_
+static const byte fun_data_frzmpy_pkg2_mod__lt_module_gt_[23] = {
+    0x10,0x06, // prelude
+    0x01, // names: <module>
+    0x20,0x67, // code info
+    0x11,0x03, // LOAD_NAME 'print'
+    0x23,0x00, // LOAD_CONST_OBJ 0
+    0x34,0x01, // CALL_FUNCTION 1
+    0x59, // POP_TOP
+    0x54, // LOAD_BUILD_CLASS
+    0x32,0x00, // MAKE_FUNCTION 0
+    0x10,0x02, // LOAD_CONST_STRING 'Foo'
+    0x34,0x02, // CALL_FUNCTION 2
+    0x16,0x02, // STORE_NAME 'Foo'
+    0x51, // LOAD_CONST_NONE
+    0x63, // RETURN_VALUE
+};
+// child of frzmpy_pkg2_mod__lt_module_gt_
+// frozen bytecode for file frzmpy_pkg2/mod.py, scope frzmpy_pkg2_mod_Foo
+static const byte fun_data_frzmpy_pkg2_mod_Foo[18] = {
+    0x00,0x06, // prelude
+    0x02, // names: Foo
+    0x68,0x40, // code info
+    0x11,0x04, // LOAD_NAME '__name__'
+    0x16,0x05, // STORE_NAME '__module__'
+    0x10,0x02, // LOAD_CONST_STRING 'Foo'
+    0x16,0x06, // STORE_NAME '__qualname__'
+    0x81, // LOAD_CONST_SMALL_INT 1
+    0x16,0x07, // STORE_NAME 'x'
+    0x51, // LOAD_CONST_NONE
+    0x63, // RETURN_VALUE
+};
+#if MICROPY_PERSISTENT_CODE_SAVE
+static const mp_raw_code_truncated_t proto_fun_frzmpy_pkg2_mod_Foo = {
+    .proto_fun_indicator[0] = MP_PROTO_FUN_INDICATOR_RAW_CODE_0,
+    .proto_fun_indicator[1] = MP_PROTO_FUN_INDICATOR_RAW_CODE_1,
+    .kind = MP_CODE_BYTECODE,
+    .is_generator = 0,
+    .fun_data = fun_data_frzmpy_pkg2_mod_Foo,
+    .children = NULL,
+    #if MICROPY_PERSISTENT_CODE_SAVE
+    .fun_data_len = 18,
+    .n_children = 0,
+    #if MICROPY_EMIT_MACHINE_CODE
+    .prelude_offset = 0,
+    #endif
+    #if MICROPY_PY_SYS_SETTRACE
+    .line_of_definition = 0,
+    .prelude = {
+        .n_state = 1,
+        .n_exc_stack = 0,
+        .scope_flags = 0,
+        .n_pos_args = 0,
+        .n_kwonly_args = 0,
+        .n_def_pos_args = 0,
+        .qstr_block_name_idx = 2,
+        .line_info = fun_data_frzmpy_pkg2_mod_Foo + 3,
+        .line_info_top = fun_data_frzmpy_pkg2_mod_Foo + 5,
+        .opcodes = fun_data_frzmpy_pkg2_mod_Foo + 5,
+    },
+    #endif
+    #endif
+};
+#else
+#define proto_fun_frzmpy_pkg2_mod_Foo fun_data_frzmpy_pkg2_mod_Foo[0]
+#endif
+
+static const mp_raw_code_t *const children_frzmpy_pkg2_mod__lt_module_gt_[] = {
+    (const mp_raw_code_t *)&proto_fun_frzmpy_pkg2_mod_Foo,
+};
+
+static const mp_raw_code_truncated_t proto_fun_frzmpy_pkg2_mod__lt_module_gt_ = {
+    .proto_fun_indicator[0] = MP_PROTO_FUN_INDICATOR_RAW_CODE_0,
+    .proto_fun_indicator[1] = MP_PROTO_FUN_INDICATOR_RAW_CODE_1,
+    .kind = MP_CODE_BYTECODE,
+    .is_generator = 0,
+    .fun_data = fun_data_frzmpy_pkg2_mod__lt_module_gt_,
+    .children = (void *)&children_frzmpy_pkg2_mod__lt_module_gt_,
+    #if MICROPY_PERSISTENT_CODE_SAVE
+    .fun_data_len = 23,
+    .n_children = 1,
+    #if MICROPY_EMIT_MACHINE_CODE
+    .prelude_offset = 0,
+    #endif
+    #if MICROPY_PY_SYS_SETTRACE
+    .line_of_definition = 0,
+    .prelude = {
+        .n_state = 3,
+        .n_exc_stack = 0,
+        .scope_flags = 0,
+        .n_pos_args = 0,
+        .n_kwonly_args = 0,
+        .n_def_pos_args = 0,
+        .qstr_block_name_idx = 1,
+        .line_info = fun_data_frzmpy_pkg2_mod__lt_module_gt_ + 3,
+        .line_info_top = fun_data_frzmpy_pkg2_mod__lt_module_gt_ + 5,
+        .opcodes = fun_data_frzmpy_pkg2_mod__lt_module_gt_ + 5,
+    },
+    #endif
+    #endif
+};
+
+static const qstr_short_t const_qstr_table_data_frzmpy_pkg2_mod[8] = {
+    MP_QSTR_frzmpy_pkg2_slash_mod_dot_py,
+    MP_QSTR__lt_module_gt_,
+    MP_QSTR_Foo,
+    MP_QSTR_print,
+    MP_QSTR___name__,
+    MP_QSTR___module__,
+    MP_QSTR___qualname__,
+    MP_QSTR_x,
+};
+
+// constants
+
+// constant table
+static const mp_rom_obj_t const_obj_table_data_frzmpy_pkg2_mod[1] = {
+    MP_ROM_QSTR(MP_QSTR_frzmpy_pkg2_dot_mod),
+};
+
+static const mp_frozen_module_t frozen_module_frzmpy_pkg2_mod = {
+    .constants = {
+        .qstr_table = (qstr_short_t *)&const_qstr_table_data_frzmpy_pkg2_mod,
+        .obj_table = (mp_obj_t *)&const_obj_table_data_frzmpy_pkg2_mod,
+    },
+    .proto_fun = &proto_fun_frzmpy_pkg2_mod__lt_module_gt_,
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// frozen module frozentest
+// - original source file: /root/repo/tests/frozen/frozentest.mpy
+// - frozen file name: frozentest.py
+// - .mpy header: 4d:06:02:1f
+
+// frozen bytecode for file frozentest.py, scope frozentest__lt_module_gt_
+static const byte fun_data_frozentest__lt_module_gt_[70] = {
+    0x10,0x0e, // prelude
+    0x01, // names: <module>
+    0x27,0x27,0x27,0x27,0x2a,0x26, // code info
+    0x11,0x02, // LOAD_NAME 'print'
+    0x10,0x03, // LOAD_CONST_STRING 'uPy'
+    0x34,0x01, // CALL_FUNCTION 1
+    0x59, // POP_TOP
+    0x11,0x02, // LOAD_NAME 'print'
+    0x23,0x00, // LOAD_CONST_OBJ 0
+    0x34,0x01, // CALL_FUNCTION 1
+    0x59, // POP_TOP
+    0x11,0x02, // LOAD_NAME 'print'
+    0x23,0x01, // LOAD_CONST_OBJ 1
+    0x34,0x01, // CALL_FUNCTION 1
+    0x59, // POP_TOP
+    0x11,0x02, // LOAD_NAME 'print'
+    0x23,0x02, // LOAD_CONST_OBJ 2
+    0x34,0x01, // CALL_FUNCTION 1
+    0x59, // POP_TOP
+    0x11,0x02, // LOAD_NAME 'print'
+    0x22,0xba,0xef,0x9a,0x15, // LOAD_CONST_SMALL_INT 123456789
+    0x34,0x01, // CALL_FUNCTION 1
+    0x59, // POP_TOP
+    0x80, // LOAD_CONST_SMALL_INT 0
+    0x42,0x4c, // JUMP 12
+    0x57, // DUP_TOP
+    0x16,0x04, // STORE_NAME 'i'
+    0x11,0x02, // LOAD_NAME 'print'
+    0x11,0x04, // LOAD_NAME 'i'
+    0x34,0x01, // CALL_FUNCTION 1
+    0x59, // POP_TOP
+    0x81, // LOAD_CONST_SMALL_INT 1
+    0xe5, // BINARY_OP 14 __iadd__
+    0x57, // DUP_TOP
+    0x84, // LOAD_CONST_SMALL_INT 4
+    0xd7, // BINARY_OP 0 __lt__
+    0x43,0x2f, // POP_JUMP_IF_TRUE -17
+    0x59, // POP_TOP
+    0x51, // LOAD_CONST_NONE
+    0x63, // RETURN_VALUE
+};
+#if MICROPY_PERSISTENT_CODE_SAVE
+static const mp_raw_code_truncated_t proto_fun_frozentest__lt_module_gt_ = {
+    .proto_fun_indicator[0] = MP_PROTO_FUN_INDICATOR_RAW_CODE_0,
+    .proto_fun_indicator[1] = MP_PROTO_FUN_INDICATOR_RAW_CODE_1,
+    .kind = MP_CODE_BYTECODE,
+    .is_generator = 0,
+    .fun_data = fun_data_frozentest__lt_module_gt_,
+    .children = NULL,
+    #if MICROPY_PERSISTENT_CODE_SAVE
+    .fun_data_len = 70,
+    .n_children = 0,
+    #if MICROPY_EMIT_MACHINE_CODE
+    .prelude_offset = 0,
+    #endif
+    #if MICROPY_PY_SYS_SETTRACE
+    .line_of_definition = 0,
+    .prelude = {
+        .n_state = 3,
+        .n_exc_stack = 0,
+        .scope_flags = 0,
+        .n_pos_args = 0,
+        .n_kwonly_args = 0,
+        .n_def_pos_args = 0,
+        .qstr_block_name_idx = 1,
+        .line_info = fun_data_frozentest__lt_module_gt_ + 3,
+        .line_info_top = fun_data_frozentest__lt_module_gt_ + 9,
+        .opcodes = fun_data_frozentest__lt_module_gt_ + 9,
+    },
+    #endif
+    #endif
+};
+#else
+#define proto_fun_frozentest__lt_module_gt_ fun_data_frozentest__lt_module_gt_[0]
+#endif
+
+static const qstr_short_t const_qstr_table_data_frozentest[5] = {
+    MP_QSTR_frozentest_dot_py,
+    MP_QSTR__lt_module_gt_,
+    MP_QSTR_print,
+    MP_QSTR_uPy,
+    MP_QSTR_i,
+};
+
+// constants
+static const mp_obj_str_t const_obj_frozentest_0 = {{&mp_type_str}, 51702, 34, (const byte*)"\x61\x20\x6c\x6f\x6e\x67\x20\x73\x74\x72\x69\x6e\x67\x20\x74\x68\x61\x74\x20\x69\x73\x20\x6e\x6f\x74\x20\x69\x6e\x74\x65\x72\x6e\x65\x64"};
+static const mp_obj_str_t const_obj_frozentest_1 = {{&mp_type_str}, 33736, 38, (const byte*)"\x61\x20\x73\x74\x72\x69\x6e\x67\x20\x74\x68\x61\x74\x20\x68\x61\x73\x20\x75\x6e\x69\x63\x6f\x64\x65\x20\xce\xb1\xce\xb2\xce\xb3\x20\x63\x68\x61\x72\x73"};
+static const mp_obj_str_t const_obj_frozentest_2 = {{&mp_type_bytes}, 6969, 11, (const byte*)"\x62\x79\x74\x65\x73\x20\x31\x32\x33\x34\x01"};
+
+// constant table
+static const mp_rom_obj_t const_obj_table_data_frozentest[3] = {
+    MP_ROM_PTR(&const_obj_frozentest_0),
+    MP_ROM_PTR(&const_obj_frozentest_1),
+    MP_ROM_PTR(&const_obj_frozentest_2),
+};
+
+static const mp_frozen_module_t frozen_module_frozentest = {
+    .constants = {
+        .qstr_table = (qstr_short_t *)&const_qstr_table_data_frozentest,
+        .obj_table = (mp_obj_t *)&const_obj_table_data_frozentest,
+    },
+    .proto_fun = &proto_fun_frozentest__lt_module_gt_,
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// collection of all frozen modules
+
+const char mp_frozen_names[] = {
+    #ifdef MP_FROZEN_STR_NAMES
+    MP_FROZEN_STR_NAMES
+    #endif
+    "frzqstr.py\0"
+    "frzmpy3.py\0"
+    "frzmpy4.py\0"
+    "frzmpy2.py\0"
+    "frzmpy1.py\0"
+    "frzmpy_pkg1/__init__.py\0"
+    "frzmpy_pkg2/mod.py\0"
+    "frozentest.py\0"
+    "\0"
+};
+
+const mp_frozen_module_t *const mp_frozen_mpy_content[] = {
+    &frozen_module_frzqstr,
+    &frozen_module_frzmpy3,
+    &frozen_module_frzmpy4,
+    &frozen_module_frzmpy2,
+    &frozen_module_frzmpy1,
+    &frozen_module_frzmpy_pkg1___init__,
+    &frozen_module_frzmpy_pkg2_mod,
+    &frozen_module_frozentest,
+};
+
+#ifdef MICROPY_FROZEN_LIST_ITEM
+MICROPY_FROZEN_LIST_ITEM("frzqstr", "frzqstr.py")
+MICROPY_FROZEN_LIST_ITEM("frzmpy3", "frzmpy3.py")
+MICROPY_FROZEN_LIST_ITEM("frzmpy4", "frzmpy4.py")
+MICROPY_FROZEN_LIST_ITEM("frzmpy2", "frzmpy2.py")
+MICROPY_FROZEN_LIST_ITEM("frzmpy1", "frzmpy1.py")
+MICROPY_FROZEN_LIST_ITEM("frzmpy_pkg1", "frzmpy_pkg1/__init__.py")
+MICROPY_FROZEN_LIST_ITEM("frzmpy_pkg2/mod", "frzmpy_pkg2/mod.py")
+MICROPY_FROZEN_LIST_ITEM("frozentest", "frozentest.py")
+#endif
+
+/*
+byte sizes:
+qstr content: 21 unique, 259 bytes
+bc content: 268
+const str content: 85
+const int content: 0
+const obj content: 64
+const table qstr content: 0 entries, 0 bytes
+const table ptr content: 6 entries, 24 bytes
+raw code content: 12 * 4 = 192
+mp_frozen_mpy_names_content: 113
+mp_frozen_mpy_content_size: 32
+total: 1037
+*/
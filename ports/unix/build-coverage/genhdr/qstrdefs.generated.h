@@ -0,0 +1,780 @@
+// This file was automatically generated by makeqstrdata.py
+
+QDEF0(MP_QSTRnull, 0, 0, "")
+QDEF0(MP_QSTR_, 5381, 0, "")
+QDEF0(MP_QSTR___dir__, 36730, 7, "__dir__")
+QDEF0(MP_QSTR__0x0a_, 46511, 1, "\x0a")
+QDEF0(MP_QSTR__space_, 46469, 1, " ")
+QDEF0(MP_QSTR__star_, 46479, 1, "*")
+QDEF0(MP_QSTR__slash_, 46474, 1, "/")
+QDEF0(MP_QSTR__lt_module_gt_, 38077, 8, "<module>")
+QDEF0(MP_QSTR__, 46586, 1, "_")
+QDEF0(MP_QSTR___call__, 63911, 8, "__call__")
+QDEF0(MP_QSTR___class__, 50475, 9, "__class__")
+QDEF0(MP_QSTR___delitem__, 13821, 11, "__delitem__")
+QDEF0(MP_QSTR___enter__, 47725, 9, "__enter__")
+QDEF0(MP_QSTR___exit__, 63557, 8, "__exit__")
+QDEF0(MP_QSTR___getattr__, 63552, 11, "__getattr__")
+QDEF0(MP_QSTR___getitem__, 14630, 11, "__getitem__")
+QDEF0(MP_QSTR___hash__, 51447, 8, "__hash__")
+QDEF0(MP_QSTR___init__, 42335, 8, "__init__")
+QDEF0(MP_QSTR___int__, 6934, 7, "__int__")
+QDEF0(MP_QSTR___iter__, 13007, 8, "__iter__")
+QDEF0(MP_QSTR___len__, 45282, 7, "__len__")
+QDEF0(MP_QSTR___main__, 5006, 8, "__main__")
+QDEF0(MP_QSTR___module__, 12543, 10, "__module__")
+QDEF0(MP_QSTR___name__, 14562, 8, "__name__")
+QDEF0(MP_QSTR___new__, 5497, 7, "__new__")
+QDEF0(MP_QSTR___next__, 29442, 8, "__next__")
+QDEF0(MP_QSTR___qualname__, 107, 12, "__qualname__")
+QDEF0(MP_QSTR___repr__, 2832, 8, "__repr__")
+QDEF0(MP_QSTR___setitem__, 15922, 11, "__setitem__")
+QDEF0(MP_QSTR___str__, 52688, 7, "__str__")
+QDEF0(MP_QSTR_ArithmeticError, 35885, 15, "ArithmeticError")
+QDEF0(MP_QSTR_AssertionError, 23191, 14, "AssertionError")
+QDEF0(MP_QSTR_AttributeError, 56865, 14, "AttributeError")
+QDEF0(MP_QSTR_BaseException, 37383, 13, "BaseException")
+QDEF0(MP_QSTR_EOFError, 49041, 8, "EOFError")
+QDEF0(MP_QSTR_Ellipsis, 57584, 8, "Ellipsis")
+QDEF0(MP_QSTR_Exception, 10738, 9, "Exception")
+QDEF0(MP_QSTR_GeneratorExit, 25110, 13, "GeneratorExit")
+QDEF0(MP_QSTR_ImportError, 39968, 11, "ImportError")
+QDEF0(MP_QSTR_IndentationError, 8284, 16, "IndentationError")
+QDEF0(MP_QSTR_IndexError, 44419, 10, "IndexError")
+QDEF0(MP_QSTR_KeyError, 234, 8, "KeyError")
+QDEF0(MP_QSTR_KeyboardInterrupt, 58031, 17, "KeyboardInterrupt")
+QDEF0(MP_QSTR_LookupError, 27135, 11, "LookupError")
+QDEF0(MP_QSTR_MemoryError, 33756, 11, "MemoryError")
+QDEF0(MP_QSTR_NameError, 11706, 9, "NameError")
+QDEF0(MP_QSTR_NoneType, 26647, 8, "NoneType")
+QDEF0(MP_QSTR_NotImplementedError, 39110, 19, "NotImplementedError")
+QDEF0(MP_QSTR_OSError, 26017, 7, "OSError")
+QDEF0(MP_QSTR_OverflowError, 57729, 13, "OverflowError")
+QDEF0(MP_QSTR_RuntimeError, 61793, 12, "RuntimeError")
+QDEF0(MP_QSTR_StopIteration, 7402, 13, "StopIteration")
+QDEF0(MP_QSTR_SyntaxError, 36756, 11, "SyntaxError")
+QDEF0(MP_QSTR_SystemExit, 65312, 10, "SystemExit")
+QDEF0(MP_QSTR_TypeError, 38437, 9, "TypeError")
+QDEF0(MP_QSTR_ValueError, 34710, 10, "ValueError")
+QDEF0(MP_QSTR_ZeroDivisionError, 10166, 17, "ZeroDivisionError")
+QDEF0(MP_QSTR_abs, 12949, 3, "abs")
+QDEF0(MP_QSTR_all, 13124, 3, "all")
+QDEF0(MP_QSTR_any, 13075, 3, "any")
+QDEF0(MP_QSTR_append, 38763, 6, "append")
+QDEF0(MP_QSTR_args, 50882, 4, "args")
+QDEF0(MP_QSTR_bool, 15595, 4, "bool")
+QDEF0(MP_QSTR_builtins, 12791, 8, "builtins")
+QDEF0(MP_QSTR_bytearray, 41846, 9, "bytearray")
+QDEF0(MP_QSTR_bytecode, 32034, 8, "bytecode")
+QDEF0(MP_QSTR_bytes, 45660, 5, "bytes")
+QDEF0(MP_QSTR_callable, 28685, 8, "callable")
+QDEF0(MP_QSTR_chr, 19676, 3, "chr")
+QDEF0(MP_QSTR_classmethod, 36020, 11, "classmethod")
+QDEF0(MP_QSTR_clear, 41084, 5, "clear")
+QDEF0(MP_QSTR_close, 26419, 5, "close")
+QDEF0(MP_QSTR_const, 65472, 5, "const")
+QDEF0(MP_QSTR_copy, 56288, 4, "copy")
+QDEF0(MP_QSTR_count, 19878, 5, "count")
+QDEF0(MP_QSTR_dict, 64575, 4, "dict")
+QDEF0(MP_QSTR_dir, 7930, 3, "dir")
+QDEF0(MP_QSTR_divmod, 1208, 6, "divmod")
+QDEF0(MP_QSTR_end, 8970, 3, "end")
+QDEF0(MP_QSTR_endswith, 41755, 8, "endswith")
+QDEF0(MP_QSTR_eval, 42651, 4, "eval")
+QDEF0(MP_QSTR_exec, 49182, 4, "exec")
+QDEF0(MP_QSTR_extend, 59491, 6, "extend")
+QDEF0(MP_QSTR_find, 13312, 4, "find")
+QDEF0(MP_QSTR_format, 13094, 6, "format")
+QDEF0(MP_QSTR_from_bytes, 29749, 10, "from_bytes")
+QDEF0(MP_QSTR_get, 15155, 3, "get")
+QDEF0(MP_QSTR_getattr, 6080, 7, "getattr")
+QDEF0(MP_QSTR_globals, 18845, 7, "globals")
+QDEF0(MP_QSTR_hasattr, 45196, 7, "hasattr")
+QDEF0(MP_QSTR_hash, 28855, 4, "hash")
+QDEF0(MP_QSTR_id, 28456, 2, "id")
+QDEF0(MP_QSTR_index, 10363, 5, "index")
+QDEF0(MP_QSTR_insert, 21522, 6, "insert")
+QDEF0(MP_QSTR_int, 21270, 3, "int")
+QDEF0(MP_QSTR_isalpha, 14315, 7, "isalpha")
+QDEF0(MP_QSTR_isdigit, 39592, 7, "isdigit")
+QDEF0(MP_QSTR_isinstance, 48822, 10, "isinstance")
+QDEF0(MP_QSTR_islower, 33020, 7, "islower")
+QDEF0(MP_QSTR_isspace, 63579, 7, "isspace")
+QDEF0(MP_QSTR_issubclass, 32693, 10, "issubclass")
+QDEF0(MP_QSTR_isupper, 42973, 7, "isupper")
+QDEF0(MP_QSTR_items, 21475, 5, "items")
+QDEF0(MP_QSTR_iter, 8591, 4, "iter")
+QDEF0(MP_QSTR_join, 23719, 4, "join")
+QDEF0(MP_QSTR_key, 27954, 3, "key")
+QDEF0(MP_QSTR_keys, 4865, 4, "keys")
+QDEF0(MP_QSTR_len, 16482, 3, "len")
+QDEF0(MP_QSTR_list, 7463, 4, "list")
+QDEF0(MP_QSTR_little, 27273, 6, "little")
+QDEF0(MP_QSTR_locals, 41275, 6, "locals")
+QDEF0(MP_QSTR_lower, 52166, 5, "lower")
+QDEF0(MP_QSTR_lstrip, 47589, 6, "lstrip")
+QDEF0(MP_QSTR_main, 47054, 4, "main")
+QDEF0(MP_QSTR_map, 17337, 3, "map")
+QDEF0(MP_QSTR_micropython, 31755, 11, "micropython")
+QDEF0(MP_QSTR_next, 34882, 4, "next")
+QDEF0(MP_QSTR_object, 36240, 6, "object")
+QDEF0(MP_QSTR_open, 15057, 4, "open")
+QDEF0(MP_QSTR_ord, 24092, 3, "ord")
+QDEF0(MP_QSTR_pop, 29482, 3, "pop")
+QDEF0(MP_QSTR_popitem, 11455, 7, "popitem")
+QDEF0(MP_QSTR_pow, 29485, 3, "pow")
+QDEF0(MP_QSTR_print, 50772, 5, "print")
+QDEF0(MP_QSTR_range, 24090, 5, "range")
+QDEF0(MP_QSTR_read, 63927, 4, "read")
+QDEF0(MP_QSTR_readinto, 48971, 8, "readinto")
+QDEF0(MP_QSTR_readline, 6649, 8, "readline")
+QDEF0(MP_QSTR_remove, 35427, 6, "remove")
+QDEF0(MP_QSTR_replace, 9545, 7, "replace")
+QDEF0(MP_QSTR_repr, 63440, 4, "repr")
+QDEF0(MP_QSTR_reverse, 10789, 7, "reverse")
+QDEF0(MP_QSTR_rfind, 40146, 5, "rfind")
+QDEF0(MP_QSTR_rindex, 11241, 6, "rindex")
+QDEF0(MP_QSTR_round, 9703, 5, "round")
+QDEF0(MP_QSTR_rsplit, 165, 6, "rsplit")
+QDEF0(MP_QSTR_rstrip, 38203, 6, "rstrip")
+QDEF0(MP_QSTR_self, 30585, 4, "self")
+QDEF0(MP_QSTR_send, 30393, 4, "send")
+QDEF0(MP_QSTR_sep, 36643, 3, "sep")
+QDEF0(MP_QSTR_set, 36647, 3, "set")
+QDEF0(MP_QSTR_setattr, 43220, 7, "setattr")
+QDEF0(MP_QSTR_setdefault, 41836, 10, "setdefault")
+QDEF0(MP_QSTR_sort, 40383, 4, "sort")
+QDEF0(MP_QSTR_sorted, 5470, 6, "sorted")
+QDEF0(MP_QSTR_split, 13239, 5, "split")
+QDEF0(MP_QSTR_start, 61317, 5, "start")
+QDEF0(MP_QSTR_startswith, 59508, 10, "startswith")
+QDEF0(MP_QSTR_staticmethod, 44898, 12, "staticmethod")
+QDEF0(MP_QSTR_step, 13911, 4, "step")
+QDEF0(MP_QSTR_stop, 13981, 4, "stop")
+QDEF0(MP_QSTR_str, 36176, 3, "str")
+QDEF0(MP_QSTR_strip, 7721, 5, "strip")
+QDEF0(MP_QSTR_sum, 36142, 3, "sum")
+QDEF0(MP_QSTR_super, 45764, 5, "super")
+QDEF0(MP_QSTR_throw, 17587, 5, "throw")
+QDEF0(MP_QSTR_to_bytes, 16088, 8, "to_bytes")
+QDEF0(MP_QSTR_tuple, 16893, 5, "tuple")
+QDEF0(MP_QSTR_type, 32669, 4, "type")
+QDEF0(MP_QSTR_update, 30388, 6, "update")
+QDEF0(MP_QSTR_upper, 37927, 5, "upper")
+QDEF0(MP_QSTR_utf_hyphen_8, 33463, 5, "utf-8")
+QDEF0(MP_QSTR_value, 13390, 5, "value")
+QDEF0(MP_QSTR_values, 48765, 6, "values")
+QDEF0(MP_QSTR_write, 43160, 5, "write")
+QDEF0(MP_QSTR_zip, 44262, 3, "zip")
+QDEF1(MP_QSTR__percent__hash_o, 6764, 3, "%#o")
+QDEF1(MP_QSTR__percent__hash_x, 6779, 3, "%#x")
+QDEF1(MP_QSTR__dot__dot__dot__space_, 10379, 4, "... ")
+QDEF1(MP_QSTR__dot_frozen, 62593, 7, ".frozen")
+QDEF0(MP_QSTR__lt_dictcomp_gt_, 36300, 10, "<dictcomp>")
+QDEF0(MP_QSTR__lt_genexpr_gt_, 27188, 9, "<genexpr>")
+QDEF0(MP_QSTR__lt_lambda_gt_, 35968, 8, "<lambda>")
+QDEF0(MP_QSTR__lt_listcomp_gt_, 5588, 10, "<listcomp>")
+QDEF0(MP_QSTR__lt_setcomp_gt_, 20820, 9, "<setcomp>")
+QDEF1(MP_QSTR__lt_stdin_gt_, 25571, 7, "<stdin>")
+QDEF1(MP_QSTR__lt_string_gt_, 21330, 8, "<string>")
+QDEF1(MP_QSTR__gt__gt__gt__space_, 44187, 4, ">>> ")
+QDEF1(MP_QSTR_AF_INET, 47083, 7, "AF_INET")
+QDEF1(MP_QSTR_AF_INET6, 46461, 8, "AF_INET6")
+QDEF1(MP_QSTR_AF_UNIX, 503, 7, "AF_UNIX")
+QDEF1(MP_QSTR_ARRAY, 31324, 5, "ARRAY")
+QDEF1(MP_QSTR_AUTO, 47338, 4, "AUTO")
+QDEF1(MP_QSTR_AdvancedTimer, 26460, 13, "AdvancedTimer")
+QDEF1(MP_QSTR_B1000000, 49526, 8, "B1000000")
+QDEF1(MP_QSTR_B115200, 62112, 7, "B115200")
+QDEF1(MP_QSTR_B1152000, 18064, 8, "B1152000")
+QDEF1(MP_QSTR_B230400, 40866, 7, "B230400")
+QDEF1(MP_QSTR_B460800, 47725, 7, "B460800")
+QDEF1(MP_QSTR_B500000, 3586, 7, "B500000")
+QDEF1(MP_QSTR_B57600, 39955, 6, "B57600")
+QDEF1(MP_QSTR_B576000, 7747, 7, "B576000")
+QDEF1(MP_QSTR_B921600, 22763, 7, "B921600")
+QDEF1(MP_QSTR_B9600, 39560, 5, "B9600")
+QDEF1(MP_QSTR_BFINT16, 58005, 7, "BFINT16")
+QDEF1(MP_QSTR_BFINT32, 57939, 7, "BFINT32")
+QDEF1(MP_QSTR_BFINT8, 39498, 6, "BFINT8")
+QDEF1(MP_QSTR_BFUINT16, 42560, 8, "BFUINT16")
+QDEF1(MP_QSTR_BFUINT32, 42502, 8, "BFUINT32")
+QDEF1(MP_QSTR_BFUINT8, 44991, 7, "BFUINT8")
+QDEF1(MP_QSTR_BF_LEN, 45081, 6, "BF_LEN")
+QDEF1(MP_QSTR_BF_POS, 40274, 6, "BF_POS")
+QDEF1(MP_QSTR_BIG_ENDIAN, 20991, 10, "BIG_ENDIAN")
+QDEF1(MP_QSTR_BufferedWriter, 11499, 14, "BufferedWriter")
+QDEF1(MP_QSTR_BytesIO, 46874, 7, "BytesIO")
+QDEF1(MP_QSTR_CancelledError, 39926, 14, "CancelledError")
+QDEF1(MP_QSTR_DEBUG, 27956, 5, "DEBUG")
+QDEF1(MP_QSTR_DeflateIO, 11960, 9, "DeflateIO")
+QDEF1(MP_QSTR_EACCES, 49719, 6, "EACCES")
+QDEF1(MP_QSTR_EADDRINUSE, 4375, 10, "EADDRINUSE")
+QDEF1(MP_QSTR_EAGAIN, 60448, 6, "EAGAIN")
+QDEF1(MP_QSTR_EALREADY, 5446, 8, "EALREADY")
+QDEF1(MP_QSTR_EBADF, 41825, 5, "EBADF")
+QDEF1(MP_QSTR_ECONNABORTED, 43815, 12, "ECONNABORTED")
+QDEF1(MP_QSTR_ECONNREFUSED, 11322, 12, "ECONNREFUSED")
+QDEF1(MP_QSTR_ECONNRESET, 64281, 10, "ECONNRESET")
+QDEF1(MP_QSTR_EEXIST, 44371, 6, "EEXIST")
+QDEF1(MP_QSTR_EHOSTUNREACH, 9606, 12, "EHOSTUNREACH")
+QDEF1(MP_QSTR_EINPROGRESS, 41114, 11, "EINPROGRESS")
+QDEF1(MP_QSTR_EINVAL, 65372, 6, "EINVAL")
+QDEF1(MP_QSTR_EIO, 42630, 3, "EIO")
+QDEF1(MP_QSTR_EISDIR, 20389, 6, "EISDIR")
+QDEF1(MP_QSTR_ENOBUFS, 34787, 7, "ENOBUFS")
+QDEF1(MP_QSTR_ENODEV, 26550, 6, "ENODEV")
+QDEF1(MP_QSTR_ENOENT, 25950, 6, "ENOENT")
+QDEF1(MP_QSTR_ENOMEM, 34212, 6, "ENOMEM")
+QDEF1(MP_QSTR_ENOTCONN, 55161, 8, "ENOTCONN")
+QDEF1(MP_QSTR_EOPNOTSUPP, 38828, 10, "EOPNOTSUPP")
+QDEF1(MP_QSTR_EPERM, 32746, 5, "EPERM")
+QDEF1(MP_QSTR_ETIMEDOUT, 63743, 9, "ETIMEDOUT")
+QDEF1(MP_QSTR_FLOAT32, 34740, 7, "FLOAT32")
+QDEF1(MP_QSTR_FLOAT64, 34583, 7, "FLOAT64")
+QDEF1(MP_QSTR_FileIO, 5573, 6, "FileIO")
+QDEF1(MP_QSTR_FrameBuffer, 48856, 11, "FrameBuffer")
+QDEF1(MP_QSTR_FrameBuffer1, 39401, 12, "FrameBuffer1")
+QDEF1(MP_QSTR_GS2_HMSB, 49960, 8, "GS2_HMSB")
+QDEF1(MP_QSTR_GS4_HMSB, 29550, 8, "GS4_HMSB")
+QDEF1(MP_QSTR_GS8, 49321, 3, "GS8")
+QDEF1(MP_QSTR_GZIP, 59137, 4, "GZIP")
+QDEF1(MP_QSTR_INT, 55094, 3, "INT")
+QDEF1(MP_QSTR_INT16, 30353, 5, "INT16")
+QDEF1(MP_QSTR_INT32, 30295, 5, "INT32")
+QDEF1(MP_QSTR_INT64, 30196, 5, "INT64")
+QDEF1(MP_QSTR_INT8, 48590, 4, "INT8")
+QDEF1(MP_QSTR_IOBase, 48694, 6, "IOBase")
+QDEF1(MP_QSTR_IncrementalDecoder, 13879, 18, "IncrementalDecoder")
+QDEF1(MP_QSTR_LITTLE_ENDIAN, 23487, 13, "LITTLE_ENDIAN")
+QDEF1(MP_QSTR_LONG, 25871, 4, "LONG")
+QDEF1(MP_QSTR_LONGLONG, 54405, 8, "LONGLONG")
+QDEF1(MP_QSTR_LockType, 8246, 8, "LockType")
+QDEF1(MP_QSTR_MONO_HLSB, 38988, 9, "MONO_HLSB")
+QDEF1(MP_QSTR_MONO_HMSB, 33741, 9, "MONO_HMSB")
+QDEF1(MP_QSTR_MONO_VLSB, 64530, 9, "MONO_VLSB")
+QDEF1(MP_QSTR_MSG_DONTROUTE, 24043, 13, "MSG_DONTROUTE")
+QDEF1(MP_QSTR_MSG_DONTWAIT, 51353, 12, "MSG_DONTWAIT")
+QDEF1(MP_QSTR_MVLSB, 5123, 5, "MVLSB")
+QDEF1(MP_QSTR_NATIVE, 36356, 6, "NATIVE")
+QDEF1(MP_QSTR_None, 53615, 4, "None")
+QDEF1(MP_QSTR_NotImplemented, 50750, 14, "NotImplemented")
+QDEF1(MP_QSTR_OrderedDict, 32496, 11, "OrderedDict")
+QDEF1(MP_QSTR_POLLERR, 49375, 7, "POLLERR")
+QDEF1(MP_QSTR_POLLHUP, 35447, 7, "POLLHUP")
+QDEF1(MP_QSTR_POLLIN, 24957, 6, "POLLIN")
+QDEF1(MP_QSTR_POLLOUT, 34164, 7, "POLLOUT")
+QDEF1(MP_QSTR_PTR, 3251, 3, "PTR")
+QDEF1(MP_QSTR_PinBase, 17223, 7, "PinBase")
+QDEF1(MP_QSTR_RAW, 1793, 3, "RAW")
+QDEF1(MP_QSTR_RGB565, 52324, 6, "RGB565")
+QDEF1(MP_QSTR_RingIO, 145, 6, "RingIO")
+QDEF1(MP_QSTR_SHORT, 7159, 5, "SHORT")
+QDEF1(MP_QSTR_SOCK_DGRAM, 5299, 10, "SOCK_DGRAM")
+QDEF1(MP_QSTR_SOCK_RAW, 38602, 8, "SOCK_RAW")
+QDEF1(MP_QSTR_SOCK_STREAM, 48690, 11, "SOCK_STREAM")
+QDEF1(MP_QSTR_SOL_SOCKET, 57103, 10, "SOL_SOCKET")
+QDEF1(MP_QSTR_SO_BROADCAST, 50937, 12, "SO_BROADCAST")
+QDEF1(MP_QSTR_SO_ERROR, 10814, 8, "SO_ERROR")
+QDEF1(MP_QSTR_SO_KEEPALIVE, 41770, 12, "SO_KEEPALIVE")
+QDEF1(MP_QSTR_SO_LINGER, 37117, 9, "SO_LINGER")
+QDEF1(MP_QSTR_SO_REUSEADDR, 21281, 12, "SO_REUSEADDR")
+QDEF1(MP_QSTR_Signal, 58523, 6, "Signal")
+QDEF1(MP_QSTR_StopAsyncIteration, 61676, 18, "StopAsyncIteration")
+QDEF1(MP_QSTR_StringBuilder, 18001, 13, "StringBuilder")
+QDEF1(MP_QSTR_StringIO, 30326, 8, "StringIO")
+QDEF1(MP_QSTR_TCSANOW, 9558, 7, "TCSANOW")
+QDEF1(MP_QSTR_Task, 16904, 4, "Task")
+QDEF1(MP_QSTR_TaskQueue, 23705, 9, "TaskQueue")
+QDEF1(MP_QSTR_TextIOWrapper, 36269, 13, "TextIOWrapper")
+QDEF1(MP_QSTR_Timer, 8098, 5, "Timer")
+QDEF1(MP_QSTR_True, 5907, 4, "True")
+QDEF1(MP_QSTR_UINT, 15651, 4, "UINT")
+QDEF1(MP_QSTR_UINT16, 6084, 6, "UINT16")
+QDEF1(MP_QSTR_UINT32, 6018, 6, "UINT32")
+QDEF1(MP_QSTR_UINT64, 6241, 6, "UINT64")
+QDEF1(MP_QSTR_UINT8, 57787, 5, "UINT8")
+QDEF1(MP_QSTR_ULONG, 36218, 5, "ULONG")
+QDEF1(MP_QSTR_ULONGLONG, 50800, 9, "ULONGLONG")
+QDEF1(MP_QSTR_USHORT, 62626, 6, "USHORT")
+QDEF1(MP_QSTR_UnicodeError, 53538, 12, "UnicodeError")
+QDEF1(MP_QSTR_VOID, 62001, 4, "VOID")
+QDEF1(MP_QSTR_VfsFat, 39701, 6, "VfsFat")
+QDEF1(MP_QSTR_VfsLfs1, 30190, 7, "VfsLfs1")
+QDEF1(MP_QSTR_VfsLfs2, 30189, 7, "VfsLfs2")
+QDEF1(MP_QSTR_VfsPosix, 20155, 8, "VfsPosix")
+QDEF1(MP_QSTR_ViperTypeError, 1501, 14, "ViperTypeError")
+QDEF1(MP_QSTR_ZLIB, 7864, 4, "ZLIB")
+QDEF0(MP_QSTR___abs__, 54933, 7, "__abs__")
+QDEF0(MP_QSTR___add__, 33476, 7, "__add__")
+QDEF1(MP_QSTR___aenter__, 33868, 10, "__aenter__")
+QDEF1(MP_QSTR___aexit__, 53188, 9, "__aexit__")
+QDEF1(MP_QSTR___aiter__, 11086, 9, "__aiter__")
+QDEF0(MP_QSTR___and__, 56078, 7, "__and__")
+QDEF1(MP_QSTR___anext__, 46211, 9, "__anext__")
+QDEF1(MP_QSTR___bases__, 12291, 9, "__bases__")
+QDEF0(MP_QSTR___bool__, 25899, 8, "__bool__")
+QDEF1(MP_QSTR___build_class__, 34882, 15, "__build_class__")
+QDEF0(MP_QSTR___complex__, 58053, 11, "__complex__")
+QDEF0(MP_QSTR___contains__, 24518, 12, "__contains__")
+QDEF1(MP_QSTR___del__, 14184, 7, "__del__")
+QDEF1(MP_QSTR___delattr__, 30555, 11, "__delattr__")
+QDEF0(MP_QSTR___delete__, 60892, 10, "__delete__")
+QDEF1(MP_QSTR___dict__, 21631, 8, "__dict__")
+QDEF0(MP_QSTR___divmod__, 4472, 10, "__divmod__")
+QDEF0(MP_QSTR___eq__, 15985, 6, "__eq__")
+QDEF1(MP_QSTR___file__, 21507, 8, "__file__")
+QDEF0(MP_QSTR___float__, 28725, 9, "__float__")
+QDEF0(MP_QSTR___floordiv__, 24390, 12, "__floordiv__")
+QDEF0(MP_QSTR___ge__, 18087, 6, "__ge__")
+QDEF0(MP_QSTR___get__, 36787, 7, "__get__")
+QDEF1(MP_QSTR___globals__, 44701, 11, "__globals__")
+QDEF0(MP_QSTR___gt__, 33462, 6, "__gt__")
+QDEF0(MP_QSTR___iadd__, 19053, 8, "__iadd__")
+QDEF0(MP_QSTR___iand__, 8615, 8, "__iand__")
+QDEF0(MP_QSTR___ifloordiv__, 3919, 13, "__ifloordiv__")
+QDEF0(MP_QSTR___ilshift__, 41600, 11, "__ilshift__")
+QDEF0(MP_QSTR___imatmul__, 28352, 11, "__imatmul__")
+QDEF0(MP_QSTR___imod__, 34378, 8, "__imod__")
+QDEF1(MP_QSTR___import__, 15928, 10, "__import__")
+QDEF0(MP_QSTR___imul__, 52760, 8, "__imul__")
+QDEF0(MP_QSTR___invert__, 30711, 10, "__invert__")
+QDEF0(MP_QSTR___ior__, 36849, 7, "__ior__")
+QDEF0(MP_QSTR___ipow__, 54660, 8, "__ipow__")
+QDEF0(MP_QSTR___irshift__, 63710, 11, "__irshift__")
+QDEF0(MP_QSTR___isub__, 30728, 8, "__isub__")
+QDEF0(MP_QSTR___itruediv__, 545, 12, "__itruediv__")
+QDEF0(MP_QSTR___ixor__, 47369, 8, "__ixor__")
+QDEF0(MP_QSTR___le__, 5068, 6, "__le__")
+QDEF0(MP_QSTR___lshift__, 34825, 10, "__lshift__")
+QDEF0(MP_QSTR___lt__, 26717, 6, "__lt__")
+QDEF0(MP_QSTR___matmul__, 62281, 10, "__matmul__")
+QDEF0(MP_QSTR___mod__, 14179, 7, "__mod__")
+QDEF0(MP_QSTR___mul__, 16945, 7, "__mul__")
+QDEF0(MP_QSTR___ne__, 2830, 6, "__ne__")
+QDEF0(MP_QSTR___neg__, 54633, 7, "__neg__")
+QDEF0(MP_QSTR___or__, 47928, 6, "__or__")
+QDEF1(MP_QSTR___path__, 9160, 8, "__path__")
+QDEF0(MP_QSTR___pos__, 61481, 7, "__pos__")
+QDEF0(MP_QSTR___pow__, 45, 7, "__pow__")
+QDEF0(MP_QSTR___radd__, 50454, 8, "__radd__")
+QDEF0(MP_QSTR___rand__, 11996, 8, "__rand__")
+QDEF1(MP_QSTR___repl_print__, 47872, 14, "__repl_print__")
+QDEF1(MP_QSTR___reversed__, 65377, 12, "__reversed__")
+QDEF0(MP_QSTR___rfloordiv__, 38996, 13, "__rfloordiv__")
+QDEF0(MP_QSTR___rlshift__, 53531, 11, "__rlshift__")
+QDEF0(MP_QSTR___rmatmul__, 987, 11, "__rmatmul__")
+QDEF0(MP_QSTR___rmod__, 35377, 8, "__rmod__")
+QDEF0(MP_QSTR___rmul__, 355, 8, "__rmul__")
+QDEF0(MP_QSTR___ror__, 56362, 7, "__ror__")
+QDEF0(MP_QSTR___rpow__, 39679, 8, "__rpow__")
+QDEF0(MP_QSTR___rrshift__, 40389, 11, "__rrshift__")
+QDEF0(MP_QSTR___rshift__, 38999, 10, "__rshift__")
+QDEF0(MP_QSTR___rsub__, 30579, 8, "__rsub__")
+QDEF0(MP_QSTR___rtruediv__, 55130, 12, "__rtruediv__")
+QDEF0(MP_QSTR___rxor__, 34546, 8, "__rxor__")
+QDEF0(MP_QSTR___set__, 45991, 7, "__set__")
+QDEF1(MP_QSTR___setattr__, 6484, 11, "__setattr__")
+QDEF0(MP_QSTR___sizeof__, 15113, 10, "__sizeof__")
+QDEF0(MP_QSTR___sub__, 2337, 7, "__sub__")
+QDEF1(MP_QSTR___traceback__, 53071, 13, "__traceback__")
+QDEF0(MP_QSTR___truediv__, 61320, 11, "__truediv__")
+QDEF0(MP_QSTR___xor__, 60448, 7, "__xor__")
+QDEF1(MP_QSTR__asdict, 18482, 7, "_asdict")
+QDEF1(MP_QSTR__asyncio, 18906, 8, "_asyncio")
+QDEF1(MP_QSTR__machine, 19391, 8, "_machine")
+QDEF1(MP_QSTR__mpy, 10590, 4, "_mpy")
+QDEF1(MP_QSTR__task_queue, 50649, 11, "_task_queue")
+QDEF1(MP_QSTR__thread, 724, 7, "_thread")
+QDEF1(MP_QSTR_a2b_base64, 2876, 10, "a2b_base64")
+QDEF1(MP_QSTR_abs_tol, 28029, 7, "abs_tol")
+QDEF1(MP_QSTR_accept, 35205, 6, "accept")
+QDEF1(MP_QSTR_acos, 40987, 4, "acos")
+QDEF1(MP_QSTR_acosh, 41747, 5, "acosh")
+QDEF1(MP_QSTR_acquire, 54045, 7, "acquire")
+QDEF1(MP_QSTR_add, 12868, 3, "add")
+QDEF1(MP_QSTR_add_ints, 24635, 8, "add_ints")
+QDEF1(MP_QSTR_addr, 31414, 4, "addr")
+QDEF1(MP_QSTR_addressof, 63834, 9, "addressof")
+QDEF1(MP_QSTR_allocate_lock, 60908, 13, "allocate_lock")
+QDEF1(MP_QSTR_appendleft, 7856, 10, "appendleft")
+QDEF1(MP_QSTR_argv, 50887, 4, "argv")
+QDEF1(MP_QSTR_array, 29308, 5, "array")
+QDEF1(MP_QSTR_as_bytearray, 6427, 12, "as_bytearray")
+QDEF1(MP_QSTR_asin, 58704, 4, "asin")
+QDEF1(MP_QSTR_asinh, 36664, 5, "asinh")
+QDEF1(MP_QSTR_atan, 48671, 4, "atan")
+QDEF1(MP_QSTR_atan2, 33229, 5, "atan2")
+QDEF1(MP_QSTR_atanh, 33175, 5, "atanh")
+QDEF1(MP_QSTR_atexit, 39088, 6, "atexit")
+QDEF1(MP_QSTR_b2a_base64, 36668, 10, "b2a_base64")
+QDEF1(MP_QSTR_bar, 18420, 3, "bar")
+QDEF1(MP_QSTR_bin, 18656, 3, "bin")
+QDEF1(MP_QSTR_binascii, 15505, 8, "binascii")
+QDEF1(MP_QSTR_bind, 25732, 4, "bind")
+QDEF1(MP_QSTR_blit, 20726, 4, "blit")
+QDEF1(MP_QSTR_boolean, 4353, 7, "boolean")
+QDEF1(MP_QSTR_bound_method, 41623, 12, "bound_method")
+QDEF1(MP_QSTR_buffer, 41189, 6, "buffer")
+QDEF1(MP_QSTR_buffering, 56101, 9, "buffering")
+QDEF1(MP_QSTR_build, 36851, 5, "build")
+QDEF1(MP_QSTR_bytearray_at, 23708, 12, "bytearray_at")
+QDEF1(MP_QSTR_byteorder, 39265, 9, "byteorder")
+QDEF1(MP_QSTR_bytes_at, 23990, 8, "bytes_at")
+QDEF1(MP_QSTR_calcsize, 14413, 8, "calcsize")
+QDEF1(MP_QSTR_callback, 61516, 8, "callback")
+QDEF1(MP_QSTR_cancel, 34563, 6, "cancel")
+QDEF1(MP_QSTR_ceil, 45062, 4, "ceil")
+QDEF1(MP_QSTR_center, 48974, 6, "center")
+QDEF1(MP_QSTR_cexample, 53198, 8, "cexample")
+QDEF1(MP_QSTR_cfun, 40283, 4, "cfun")
+QDEF1(MP_QSTR_chdir, 45745, 5, "chdir")
+QDEF1(MP_QSTR_choice, 13102, 6, "choice")
+QDEF1(MP_QSTR_clock, 25901, 5, "clock")
+QDEF1(MP_QSTR_closure, 51828, 7, "closure")
+QDEF1(MP_QSTR_cmath, 62646, 5, "cmath")
+QDEF1(MP_QSTR_code, 55912, 4, "code")
+QDEF1(MP_QSTR_collect, 26011, 7, "collect")
+QDEF1(MP_QSTR_collections, 51424, 11, "collections")
+QDEF1(MP_QSTR_compile, 51700, 7, "compile")
+QDEF1(MP_QSTR_complex, 40389, 7, "complex")
+QDEF1(MP_QSTR_connect, 15835, 7, "connect")
+QDEF1(MP_QSTR_copysign, 5171, 8, "copysign")
+QDEF1(MP_QSTR_coro, 56244, 4, "coro")
+QDEF1(MP_QSTR_cos, 19578, 3, "cos")
+QDEF1(MP_QSTR_cosh, 56274, 4, "cosh")
+QDEF1(MP_QSTR_cppexample, 26574, 10, "cppexample")
+QDEF1(MP_QSTR_cppfunc, 57560, 7, "cppfunc")
+QDEF1(MP_QSTR_crc32, 59510, 5, "crc32")
+QDEF1(MP_QSTR_cur_task, 11763, 8, "cur_task")
+QDEF1(MP_QSTR_data, 56341, 4, "data")
+QDEF1(MP_QSTR_decode, 22953, 6, "decode")
+QDEF1(MP_QSTR_default, 32206, 7, "default")
+QDEF1(MP_QSTR_deflate, 14974, 7, "deflate")
+QDEF1(MP_QSTR_degrees, 16642, 7, "degrees")
+QDEF1(MP_QSTR_delattr, 51419, 7, "delattr")
+QDEF1(MP_QSTR_deleter, 56174, 7, "deleter")
+QDEF1(MP_QSTR_deque, 39173, 5, "deque")
+QDEF1(MP_QSTR_dict_view, 43309, 9, "dict_view")
+QDEF1(MP_QSTR_difference, 9330, 10, "difference")
+QDEF1(MP_QSTR_difference_update, 64156, 17, "difference_update")
+QDEF1(MP_QSTR_digest, 50381, 6, "digest")
+QDEF1(MP_QSTR_disable, 30353, 7, "disable")
+QDEF1(MP_QSTR_discard, 28943, 7, "discard")
+QDEF1(MP_QSTR_doc, 7981, 3, "doc")
+QDEF1(MP_QSTR_done, 837, 4, "done")
+QDEF1(MP_QSTR_dump, 12265, 4, "dump")
+QDEF1(MP_QSTR_dumps, 11642, 5, "dumps")
+QDEF1(MP_QSTR_e, 46528, 1, "e")
+QDEF1(MP_QSTR_ellipse, 56335, 7, "ellipse")
+QDEF1(MP_QSTR_enable, 56836, 6, "enable")
+QDEF1(MP_QSTR_encode, 51779, 6, "encode")
+QDEF1(MP_QSTR_encoding, 39942, 8, "encoding")
+QDEF1(MP_QSTR_end_array, 51052, 9, "end_array")
+QDEF1(MP_QSTR_end_map, 6313, 7, "end_map")
+QDEF1(MP_QSTR_enumerate, 47729, 9, "enumerate")
+QDEF1(MP_QSTR_erf, 9108, 3, "erf")
+QDEF1(MP_QSTR_erfc, 38519, 4, "erfc")
+QDEF1(MP_QSTR_errno, 4545, 5, "errno")
+QDEF1(MP_QSTR_errorcode, 56592, 9, "errorcode")
+QDEF1(MP_QSTR_example_package, 57736, 15, "example_package")
+QDEF1(MP_QSTR_example_package_dot_foo, 13600, 19, "example_package.foo")
+QDEF1(MP_QSTR_example_package_dot_foo_dot_bar, 22943, 23, "example_package.foo.bar")
+QDEF1(MP_QSTR_exc_info, 65290, 8, "exc_info")
+QDEF1(MP_QSTR_execfile, 10328, 8, "execfile")
+QDEF1(MP_QSTR_executable, 12821, 10, "executable")
+QDEF1(MP_QSTR_exit, 48773, 4, "exit")
+QDEF1(MP_QSTR_exp, 9416, 3, "exp")
+QDEF1(MP_QSTR_expm1, 29300, 5, "expm1")
+QDEF1(MP_QSTR_extra_coverage, 39534, 14, "extra_coverage")
+QDEF1(MP_QSTR_extra_cpp_coverage, 28210, 18, "extra_cpp_coverage")
+QDEF1(MP_QSTR_f, 46531, 1, "f")
+QDEF1(MP_QSTR_fabs, 4755, 4, "fabs")
+QDEF1(MP_QSTR_factorial, 13004, 9, "factorial")
+QDEF1(MP_QSTR_feed, 9127, 4, "feed")
+QDEF1(MP_QSTR_ffi, 13964, 3, "ffi")
+QDEF1(MP_QSTR_fficallback, 24261, 11, "fficallback")
+QDEF1(MP_QSTR_ffifunc, 2962, 7, "ffifunc")
+QDEF1(MP_QSTR_ffimod, 45770, 6, "ffimod")
+QDEF1(MP_QSTR_ffivar, 4937, 6, "ffivar")
+QDEF1(MP_QSTR_file, 13507, 4, "file")
+QDEF1(MP_QSTR_fileno, 30338, 6, "fileno")
+QDEF1(MP_QSTR_fill, 13514, 4, "fill")
+QDEF1(MP_QSTR_fill_rect, 60725, 9, "fill_rect")
+QDEF1(MP_QSTR_filter, 48677, 6, "filter")
+QDEF1(MP_QSTR_float, 17461, 5, "float")
+QDEF1(MP_QSTR_floor, 18045, 5, "floor")
+QDEF1(MP_QSTR_flush, 49505, 5, "flush")
+QDEF1(MP_QSTR_fmod, 17637, 4, "fmod")
+QDEF1(MP_QSTR_foo, 14243, 3, "foo")
+QDEF1(MP_QSTR_framebuf, 33385, 8, "framebuf")
+QDEF1(MP_QSTR_frexp, 38940, 5, "frexp")
+QDEF1(MP_QSTR_fromhex, 14598, 7, "fromhex")
+QDEF1(MP_QSTR_fromkeys, 48439, 8, "fromkeys")
+QDEF1(MP_QSTR_frozenset, 40173, 9, "frozenset")
+QDEF1(MP_QSTR_func, 26651, 4, "func")
+QDEF1(MP_QSTR_function, 551, 8, "function")
+QDEF1(MP_QSTR_gamma, 36866, 5, "gamma")
+QDEF1(MP_QSTR_gc, 28257, 2, "gc")
+QDEF1(MP_QSTR_generator, 50070, 9, "generator")
+QDEF1(MP_QSTR_get_ident, 45566, 9, "get_ident")
+QDEF1(MP_QSTR_getaddrinfo, 6254, 11, "getaddrinfo")
+QDEF1(MP_QSTR_getcwd, 53251, 6, "getcwd")
+QDEF1(MP_QSTR_getenv, 64430, 6, "getenv")
+QDEF1(MP_QSTR_getrandbits, 32102, 11, "getrandbits")
+QDEF1(MP_QSTR_getsizeof, 9215, 9, "getsizeof")
+QDEF1(MP_QSTR_getter, 45712, 6, "getter")
+QDEF1(MP_QSTR_getvalue, 44152, 8, "getvalue")
+QDEF1(MP_QSTR_gmtime, 36442, 6, "gmtime")
+QDEF1(MP_QSTR_group, 45242, 5, "group")
+QDEF1(MP_QSTR_groups, 51081, 6, "groups")
+QDEF1(MP_QSTR_hashlib, 27920, 7, "hashlib")
+QDEF1(MP_QSTR_heap_lock, 36013, 9, "heap_lock")
+QDEF1(MP_QSTR_heap_locked, 26444, 11, "heap_locked")
+QDEF1(MP_QSTR_heap_unlock, 11606, 11, "heap_unlock")
+QDEF1(MP_QSTR_heapify, 11695, 7, "heapify")
+QDEF1(MP_QSTR_heappop, 10198, 7, "heappop")
+QDEF1(MP_QSTR_heappush, 27527, 8, "heappush")
+QDEF1(MP_QSTR_heapq, 7528, 5, "heapq")
+QDEF1(MP_QSTR_hellocpp, 59812, 8, "hellocpp")
+QDEF1(MP_QSTR_help, 23700, 4, "help")
+QDEF1(MP_QSTR_hex, 20592, 3, "hex")
+QDEF1(MP_QSTR_hexlify, 32554, 7, "hexlify")
+QDEF1(MP_QSTR_hline, 15491, 5, "hline")
+QDEF1(MP_QSTR_idle, 56481, 4, "idle")
+QDEF1(MP_QSTR_ilistdir, 27249, 8, "ilistdir")
+QDEF1(MP_QSTR_imag, 46919, 4, "imag")
+QDEF1(MP_QSTR_implementation, 11543, 14, "implementation")
+QDEF1(MP_QSTR_indices, 18522, 7, "indices")
+QDEF1(MP_QSTR_inet_ntop, 7561, 9, "inet_ntop")
+QDEF1(MP_QSTR_inet_pton, 38089, 9, "inet_pton")
+QDEF1(MP_QSTR_inf, 21252, 3, "inf")
+QDEF1(MP_QSTR_input, 23155, 5, "input")
+QDEF1(MP_QSTR_intern, 63727, 6, "intern")
+QDEF1(MP_QSTR_intersection, 10792, 12, "intersection")
+QDEF1(MP_QSTR_intersection_update, 56582, 19, "intersection_update")
+QDEF1(MP_QSTR_invert, 183, 6, "invert")
+QDEF1(MP_QSTR_io, 28451, 2, "io")
+QDEF1(MP_QSTR_ioctl, 49784, 5, "ioctl")
+QDEF1(MP_QSTR_ipoll, 23891, 5, "ipoll")
+QDEF1(MP_QSTR_isclose, 20041, 7, "isclose")
+QDEF1(MP_QSTR_isdisjoint, 26871, 10, "isdisjoint")
+QDEF1(MP_QSTR_isenabled, 58778, 9, "isenabled")
+QDEF1(MP_QSTR_isfinite, 43942, 8, "isfinite")
+QDEF1(MP_QSTR_isinf, 4414, 5, "isinf")
+QDEF1(MP_QSTR_isnan, 926, 5, "isnan")
+QDEF1(MP_QSTR_issubset, 49593, 8, "issubset")
+QDEF1(MP_QSTR_issuperset, 60668, 10, "issuperset")
+QDEF1(MP_QSTR_itemsize, 30581, 8, "itemsize")
+QDEF1(MP_QSTR_iterable, 37413, 8, "iterable")
+QDEF1(MP_QSTR_iterator, 48711, 8, "iterator")
+QDEF1(MP_QSTR_json, 53757, 4, "json")
+QDEF1(MP_QSTR_kbd_intr, 5110, 8, "kbd_intr")
+QDEF1(MP_QSTR_keepends, 35682, 8, "keepends")
+QDEF1(MP_QSTR_ldexp, 28480, 5, "ldexp")
+QDEF1(MP_QSTR_lgamma, 27854, 6, "lgamma")
+QDEF1(MP_QSTR_libc_ver, 47615, 8, "libc_ver")
+QDEF1(MP_QSTR_line, 7371, 4, "line")
+QDEF1(MP_QSTR_listdir, 58264, 7, "listdir")
+QDEF1(MP_QSTR_listen, 3788, 6, "listen")
+QDEF1(MP_QSTR_load, 9315, 4, "load")
+QDEF1(MP_QSTR_loads, 45232, 5, "loads")
+QDEF1(MP_QSTR_localtime, 18045, 9, "localtime")
+QDEF1(MP_QSTR_lock, 9134, 4, "lock")
+QDEF1(MP_QSTR_locked, 47631, 6, "locked")
+QDEF1(MP_QSTR_log, 16161, 3, "log")
+QDEF1(MP_QSTR_log10, 37184, 5, "log10")
+QDEF1(MP_QSTR_log2, 9075, 4, "log2")
+QDEF1(MP_QSTR_lookahead, 8427, 9, "lookahead")
+QDEF1(MP_QSTR_machine, 43872, 7, "machine")
+QDEF1(MP_QSTR_makefile, 54721, 8, "makefile")
+QDEF1(MP_QSTR_map_key, 34257, 7, "map_key")
+QDEF1(MP_QSTR_match, 8854, 5, "match")
+QDEF1(MP_QSTR_math, 47925, 4, "math")
+QDEF1(MP_QSTR_max, 17329, 3, "max")
+QDEF1(MP_QSTR_maximum_space_recursion_space_depth_space_exceeded, 7795, 32, "maximum recursion depth exceeded")
+QDEF1(MP_QSTR_maxsize, 28884, 7, "maxsize")
+QDEF1(MP_QSTR_mem, 17440, 3, "mem")
+QDEF1(MP_QSTR_mem16, 51719, 5, "mem16")
+QDEF1(MP_QSTR_mem32, 51777, 5, "mem32")
+QDEF1(MP_QSTR_mem8, 51224, 4, "mem8")
+QDEF1(MP_QSTR_mem_alloc, 11090, 9, "mem_alloc")
+QDEF1(MP_QSTR_mem_current, 47638, 11, "mem_current")
+QDEF1(MP_QSTR_mem_free, 25291, 8, "mem_free")
+QDEF1(MP_QSTR_mem_info, 61905, 8, "mem_info")
+QDEF1(MP_QSTR_mem_peak, 9536, 8, "mem_peak")
+QDEF1(MP_QSTR_mem_total, 27389, 9, "mem_total")
+QDEF1(MP_QSTR_memoryview, 17513, 10, "memoryview")
+QDEF1(MP_QSTR_min, 17071, 3, "min")
+QDEF1(MP_QSTR_mkdir, 46492, 5, "mkdir")
+QDEF1(MP_QSTR_mkfs, 45174, 4, "mkfs")
+QDEF1(MP_QSTR_mktime, 11158, 6, "mktime")
+QDEF1(MP_QSTR_mode, 49190, 4, "mode")
+QDEF1(MP_QSTR_modf, 49189, 4, "modf")
+QDEF1(MP_QSTR_modify, 26357, 6, "modify")
+QDEF1(MP_QSTR_module, 39359, 6, "module")
+QDEF1(MP_QSTR_modules, 53740, 7, "modules")
+QDEF1(MP_QSTR_mount, 3496, 5, "mount")
+QDEF1(MP_QSTR_mtime, 9213, 5, "mtime")
+QDEF1(MP_QSTR_name, 30114, 4, "name")
+QDEF1(MP_QSTR_namedtuple, 5662, 10, "namedtuple")
+QDEF1(MP_QSTR_nan, 22756, 3, "nan")
+QDEF1(MP_QSTR_native, 2948, 6, "native")
+QDEF1(MP_QSTR_newline, 35127, 7, "newline")
+QDEF1(MP_QSTR_null, 51678, 4, "null")
+QDEF1(MP_QSTR_number, 63046, 6, "number")
+QDEF1(MP_QSTR_oct, 23805, 3, "oct")
+QDEF1(MP_QSTR_off, 23690, 3, "off")
+QDEF1(MP_QSTR_on, 28516, 2, "on")
+QDEF1(MP_QSTR_opt_level, 26503, 9, "opt_level")
+QDEF1(MP_QSTR_os, 28537, 2, "os")
+QDEF1(MP_QSTR_pack, 53692, 4, "pack")
+QDEF1(MP_QSTR_pack_into, 43295, 9, "pack_into")
+QDEF1(MP_QSTR_partition, 58759, 9, "partition")
+QDEF1(MP_QSTR_path, 52872, 4, "path")
+QDEF1(MP_QSTR_peek, 49534, 4, "peek")
+QDEF1(MP_QSTR_pend_throw, 29939, 10, "pend_throw")
+QDEF1(MP_QSTR_ph_key, 6901, 6, "ph_key")
+QDEF1(MP_QSTR_phase, 54634, 5, "phase")
+QDEF1(MP_QSTR_pi, 28700, 2, "pi")
+QDEF1(MP_QSTR_pixel, 61517, 5, "pixel")
+QDEF1(MP_QSTR_platform, 6458, 8, "platform")
+QDEF1(MP_QSTR_polar, 3077, 5, "polar")
+QDEF1(MP_QSTR_poll, 55706, 4, "poll")
+QDEF1(MP_QSTR_poly, 55695, 4, "poly")
+QDEF1(MP_QSTR_popleft, 39537, 7, "popleft")
+QDEF1(MP_QSTR_preview, 54767, 7, "preview")
+QDEF1(MP_QSTR_print_exception, 8732, 15, "print_exception")
+QDEF1(MP_QSTR_progsize, 54026, 8, "progsize")
+QDEF1(MP_QSTR_property, 10690, 8, "property")
+QDEF1(MP_QSTR_ps1, 28919, 3, "ps1")
+QDEF1(MP_QSTR_ps2, 28916, 3, "ps2")
+QDEF1(MP_QSTR_ptr, 28755, 3, "ptr")
+QDEF1(MP_QSTR_ptr16, 51956, 5, "ptr16")
+QDEF1(MP_QSTR_ptr32, 51890, 5, "ptr32")
+QDEF1(MP_QSTR_ptr8, 31371, 4, "ptr8")
+QDEF1(MP_QSTR_push, 32443, 4, "push")
+QDEF1(MP_QSTR_putenv, 27849, 6, "putenv")
+QDEF1(MP_QSTR_pystack_space_exhausted, 42021, 17, "pystack exhausted")
+QDEF1(MP_QSTR_pystack_use, 16894, 11, "pystack_use")
+QDEF1(MP_QSTR_python_compiler, 38285, 15, "python_compiler")
+QDEF1(MP_QSTR_qstr_info, 33200, 9, "qstr_info")
+QDEF1(MP_QSTR_r, 46551, 1, "r")
+QDEF1(MP_QSTR_radians, 16263, 7, "radians")
+QDEF1(MP_QSTR_randint, 56495, 7, "randint")
+QDEF1(MP_QSTR_random, 11454, 6, "random")
+QDEF1(MP_QSTR_randrange, 16035, 9, "randrange")
+QDEF1(MP_QSTR_rb, 28885, 2, "rb")
+QDEF1(MP_QSTR_re, 28882, 2, "re")
+QDEF1(MP_QSTR_read1, 12454, 5, "read1")
+QDEF1(MP_QSTR_readblocks, 7213, 10, "readblocks")
+QDEF1(MP_QSTR_readlines, 22890, 9, "readlines")
+QDEF1(MP_QSTR_readonly, 35075, 8, "readonly")
+QDEF1(MP_QSTR_readsize, 51666, 8, "readsize")
+QDEF1(MP_QSTR_real, 63935, 4, "real")
+QDEF1(MP_QSTR_rect, 63973, 4, "rect")
+QDEF1(MP_QSTR_recv, 63975, 4, "recv")
+QDEF1(MP_QSTR_recvfrom, 37009, 8, "recvfrom")
+QDEF1(MP_QSTR_register, 41388, 8, "register")
+QDEF1(MP_QSTR_rel_tol, 18006, 7, "rel_tol")
+QDEF1(MP_QSTR_release, 36844, 7, "release")
+QDEF1(MP_QSTR_rename, 6197, 6, "rename")
+QDEF1(MP_QSTR_reserve, 19141, 7, "reserve")
+QDEF1(MP_QSTR_reversed, 28321, 8, "reversed")
+QDEF1(MP_QSTR_rmdir, 42821, 5, "rmdir")
+QDEF1(MP_QSTR_rpartition, 53269, 10, "rpartition")
+QDEF1(MP_QSTR_schedule, 44256, 8, "schedule")
+QDEF1(MP_QSTR_scroll, 23080, 6, "scroll")
+QDEF1(MP_QSTR_search, 49579, 6, "search")
+QDEF1(MP_QSTR_seconds, 44486, 7, "seconds")
+QDEF1(MP_QSTR_seed, 30098, 4, "seed")
+QDEF1(MP_QSTR_seek, 30109, 4, "seek")
+QDEF1(MP_QSTR_select, 16781, 6, "select")
+QDEF1(MP_QSTR_sendto, 802, 6, "sendto")
+QDEF1(MP_QSTR_separators, 3307, 10, "separators")
+QDEF1(MP_QSTR_set_buf, 42889, 7, "set_buf")
+QDEF1(MP_QSTR_set_error, 64320, 9, "set_error")
+QDEF1(MP_QSTR_setblocking, 6254, 11, "setblocking")
+QDEF1(MP_QSTR_setraw, 29059, 6, "setraw")
+QDEF1(MP_QSTR_setsockopt, 59448, 10, "setsockopt")
+QDEF1(MP_QSTR_setter, 22788, 6, "setter")
+QDEF1(MP_QSTR_settimeout, 35548, 10, "settimeout")
+QDEF1(MP_QSTR_sha256, 302, 6, "sha256")
+QDEF1(MP_QSTR_sin, 37041, 3, "sin")
+QDEF1(MP_QSTR_single, 8255, 6, "single")
+QDEF1(MP_QSTR_sinh, 42681, 4, "sinh")
+QDEF1(MP_QSTR_sizeof, 29513, 6, "sizeof")
+QDEF1(MP_QSTR_sleep, 10218, 5, "sleep")
+QDEF1(MP_QSTR_sleep_ms, 25355, 8, "sleep_ms")
+QDEF1(MP_QSTR_sleep_us, 24595, 8, "sleep_us")
+QDEF1(MP_QSTR_slice, 62645, 5, "slice")
+QDEF1(MP_QSTR_sockaddr, 35938, 8, "sockaddr")
+QDEF1(MP_QSTR_socket, 52320, 6, "socket")
+QDEF1(MP_QSTR_soft_reset, 26081, 10, "soft_reset")
+QDEF1(MP_QSTR_sort_keys, 23620, 9, "sort_keys")
+QDEF1(MP_QSTR_span, 18121, 4, "span")
+QDEF1(MP_QSTR_splitlines, 54122, 10, "splitlines")
+QDEF1(MP_QSTR_sqrt, 17441, 4, "sqrt")
+QDEF1(MP_QSTR_stack_size, 15153, 10, "stack_size")
+QDEF1(MP_QSTR_stack_use, 63383, 9, "stack_use")
+QDEF1(MP_QSTR_start_array, 47651, 11, "start_array")
+QDEF1(MP_QSTR_start_map, 17894, 9, "start_map")
+QDEF1(MP_QSTR_start_new_thread, 9687, 16, "start_new_thread")
+QDEF1(MP_QSTR_stat, 13783, 4, "stat")
+QDEF1(MP_QSTR_state, 61650, 5, "state")
+QDEF1(MP_QSTR_statvfs, 6420, 7, "statvfs")
+QDEF1(MP_QSTR_stderr, 22691, 6, "stderr")
+QDEF1(MP_QSTR_stdin, 1057, 5, "stdin")
+QDEF1(MP_QSTR_stdout, 33544, 6, "stdout")
+QDEF1(MP_QSTR_stest_fileio, 10847, 12, "stest_fileio")
+QDEF1(MP_QSTR_stest_textio2, 12790, 13, "stest_textio2")
+QDEF1(MP_QSTR_string, 58736, 6, "string")
+QDEF1(MP_QSTR_struct, 36882, 6, "struct")
+QDEF1(MP_QSTR_sub, 36129, 3, "sub")
+QDEF1(MP_QSTR_symmetric_difference, 26574, 20, "symmetric_difference")
+QDEF1(MP_QSTR_symmetric_difference_update, 63584, 27, "symmetric_difference_update")
+QDEF1(MP_QSTR_sync, 25250, 4, "sync")
+QDEF1(MP_QSTR_sys, 36540, 3, "sys")
+QDEF1(MP_QSTR_system, 5280, 6, "system")
+QDEF1(MP_QSTR_tan, 25086, 3, "tan")
+QDEF1(MP_QSTR_tanh, 41430, 4, "tanh")
+QDEF1(MP_QSTR_tau, 25061, 3, "tau")
+QDEF1(MP_QSTR_tcgetattr, 50615, 9, "tcgetattr")
+QDEF1(MP_QSTR_tcsetattr, 13475, 9, "tcsetattr")
+QDEF1(MP_QSTR_tell, 45332, 4, "tell")
+QDEF1(MP_QSTR_termios, 57214, 7, "termios")
+QDEF1(MP_QSTR_text, 44952, 4, "text")
+QDEF1(MP_QSTR_threshold, 12274, 9, "threshold")
+QDEF1(MP_QSTR_ticks_add, 44701, 9, "ticks_add")
+QDEF1(MP_QSTR_ticks_cpu, 42266, 9, "ticks_cpu")
+QDEF1(MP_QSTR_ticks_diff, 57521, 10, "ticks_diff")
+QDEF1(MP_QSTR_ticks_ms, 12866, 8, "ticks_ms")
+QDEF1(MP_QSTR_ticks_us, 12634, 8, "ticks_us")
+QDEF1(MP_QSTR_time, 49648, 4, "time")
+QDEF1(MP_QSTR_time_ns, 45682, 7, "time_ns")
+QDEF1(MP_QSTR_time_pulse_us, 3209, 13, "time_pulse_us")
+QDEF1(MP_QSTR_tracebacklimit, 41242, 14, "tracebacklimit")
+QDEF1(MP_QSTR_trunc, 39259, 5, "trunc")
+QDEF1(MP_QSTR_uctypes, 29176, 7, "uctypes")
+QDEF1(MP_QSTR_uint, 15843, 4, "uint")
+QDEF1(MP_QSTR_umount, 40669, 6, "umount")
+QDEF1(MP_QSTR_unhexlify, 47537, 9, "unhexlify")
+QDEF1(MP_QSTR_uniform, 62721, 7, "uniform")
+QDEF1(MP_QSTR_union, 31990, 5, "union")
+QDEF1(MP_QSTR_unlink, 36862, 6, "unlink")
+QDEF1(MP_QSTR_unpack, 15367, 6, "unpack")
+QDEF1(MP_QSTR_unpack_from, 27918, 11, "unpack_from")
+QDEF1(MP_QSTR_unregister, 54295, 10, "unregister")
+QDEF1(MP_QSTR_unsetenv, 18049, 8, "unsetenv")
+QDEF1(MP_QSTR_urandom, 44715, 7, "urandom")
+QDEF1(MP_QSTR_usys, 62409, 4, "usys")
+QDEF1(MP_QSTR_var, 31456, 3, "var")
+QDEF1(MP_QSTR_version, 54207, 7, "version")
+QDEF1(MP_QSTR_version_info, 2670, 12, "version_info")
+QDEF1(MP_QSTR_vfs, 31366, 3, "vfs")
+QDEF1(MP_QSTR_viper, 9053, 5, "viper")
+QDEF1(MP_QSTR_vline, 63005, 5, "vline")
+QDEF1(MP_QSTR_websocket, 36240, 9, "websocket")
+QDEF1(MP_QSTR_write1, 48041, 6, "write1")
+QDEF1(MP_QSTR_writeblocks, 57090, 11, "writeblocks")
+QDEF1(MP_QSTR__brace_open__colon__hash_b_brace_close_, 14168, 5, "{:#b}")